@@ -0,0 +1,60 @@
+//Measures linting many short macros (see parseBatch in src/binding.cc): parsing each one from JS and
+// counting its named nodes, then parsing all of them with one call, with and without their flattened trees.
+//
+//Usage: node bench/batch.js [number of macros]
+
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+
+const macroCount = Number(process.argv[2]) || 100000;
+
+function macro(i) {
+	switch (i % 4) {
+		case 0: return `/em swings at @{target|token_name} [[1d20+@{selected|str_mod}+${i}]]`;
+		case 1: return `&{template:default} {{name=Attack ${i}}} {{roll=[[2d6kh1]]}}`;
+		case 2: return `[[?{Damage|2d6}+floor(@{selected|level}/2)]] damage (${i})`;
+		default: return `?{Target ${i}|Goblin,@{goblin|ac}|Orc,@{orc|ac}} misses by [[1d4]]`;
+	}
+}
+
+function countNamed(tree) {
+	let count = 0;
+	const cursor = tree.walk();
+	for (;;) {
+		if (cursor.nodeIsNamed) count++;
+		if (cursor.gotoFirstChild()) continue;
+		while (!cursor.gotoNextSibling()) {
+			if (!cursor.gotoParent()) return count;
+		}
+	}
+}
+
+function time(name, run) {
+	const start = process.hrtime.bigint();
+	const [errors, nodes] = run();
+	const elapsed = Number(process.hrtime.bigint() - start) / 1e6;
+	console.log(`${name}: ${(elapsed * 1000 / macroCount).toFixed(2)} µs/macro (${errors} with errors, ${nodes} nodes)`);
+}
+
+const macros = [];
+for (let i=0; i<macroCount; i++) macros.push(macro(i));
+console.log(`${macroCount} macros`);
+
+const parser = new Parser();
+parser.setLanguage(Roll20Script);
+time("parser.parse() for each", () => {
+	let errors = 0, nodes = 0;
+	for (const source of macros) {
+		const tree = parser.parse(source);
+		if (tree.rootNode.hasError()) errors++;
+		nodes += countNamed(tree);
+	}
+	return [errors, nodes];
+});
+
+for (const trees of [false, true]) {
+	time(`parseBatch()${trees ? " with trees" : ""}`, () => {
+		const result = Roll20Script.parseBatch(macros, { trees });
+		return [result.hasError.reduce((sum, e) => sum + e, 0), result.nodeCounts.reduce((sum, n) => sum + n, 0)];
+	});
+}
@@ -0,0 +1,63 @@
+//Measures how long it takes to parse long roll template macros, and how much of that time the
+// parser spends with more than one version of its stack (i.e., forked by a GLR conflict).
+//
+//Usage: node bench/forking.js [number of properties] [number of parses]
+
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+
+const propertyCount = Number(process.argv[2]) || 200;
+const parseCount = Number(process.argv[3]) || 50;
+
+//elements before the flag are the ones a script and a roll template have in common (a query
+// that ends a property needs a space before the property's end, or "}}}" ends the property and
+// leaves the query open)
+function templateMacro(n) {
+	let macro = "";
+	for (let i=0; i<n; i++) macro += `@{wtype} %{attacks|${i}} `;
+	macro += "&{template:atkdmg} ";
+	for (let i=0; i<n; i++) {
+		macro += `{{attack${i}=[[1d20+@{atk${i}}]] ?{Advantage|Normal,0|Advantage,1|Disadvantage,2} }} `;
+		macro += `{{damage${i}=[[?{Damage|2d6}+@{dmg${i}}]]}} `;
+	}
+	return macro;
+}
+
+//queries with a default value and queries with options, nested within each other
+function queryMacro(n) {
+	let macro = "";
+	for (let i=0; i<n; i++) {
+		macro += `?{Bonus ${i}|${i},${i}} `;
+		macro += `?{Choice ${i}|a,?{Inner&#124;x&#125;|b,?{Inner&#124;x&#44;1&#124;y&#44;2&#125;|c}} `;
+	}
+	return macro;
+}
+
+function run(name, source) {
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	
+	//the parser logs each step it takes on each version of its stack, along with how many
+	// versions there are
+	let forkedSteps = 0, maxVersions = 1;
+	parser.setLogger((message, params) => {
+		if (!message.startsWith("process")) return;
+		const match = /version_count:(\d+)/.exec(message);
+		const versions = Number(params && params.version_count || match && match[1] || 1);
+		if (versions > 1) forkedSteps++;
+		maxVersions = Math.max(maxVersions, versions);
+	});
+	const tree = parser.parse(source);
+	parser.setLogger(null);
+	
+	const start = process.hrtime.bigint();
+	for (let i=0; i<parseCount; i++) parser.parse(source);
+	const elapsed = Number(process.hrtime.bigint() - start) / 1e6 / parseCount;
+	
+	console.log(`${name}: ${source.length} bytes, ${elapsed.toFixed(3)} ms/parse, `
+		+ `${forkedSteps} steps while forked (up to ${maxVersions} stack versions), `
+		+ `${tree.rootNode.hasError() ? "has errors" : "no errors"}`);
+}
+
+run("roll template", templateMacro(propertyCount));
+run("roll queries", queryMacro(propertyCount));
@@ -0,0 +1,123 @@
+//Measures how long it takes to reparse each corpus macro after a random single-character edit,
+// incrementally (with the edited old tree) and from scratch, and checks that both give the same tree.
+//
+//Reuse is measured from the parser's log: the share of the tokens a full parse lexes that an
+// incremental parse didn't have to lex again.
+//
+//Usage: node bench/incremental.js [number of edits per macro]
+
+const fs = require("fs");
+const path = require("path");
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+
+const editCount = Number(process.argv[2]) || 50;
+
+//a fixed seed, so that every run makes the same edits
+let seed = 1;
+function random(n) {
+	seed = seed * 48271 % 2147483647;
+	return seed % n;
+}
+
+//the input of each test in the corpus
+function corpusMacros() {
+	const macros = [];
+	const corpus = path.join(__dirname, "..", "corpus");
+	for (const file of fs.readdirSync(corpus)) {
+		const tests = fs.readFileSync(path.join(corpus, file), "utf8").split(/^={3,}\n.*\n={3,}\n/m).slice(1);
+		for (const test of tests) {
+			const input = test.split(/\n-{3,}\n/)[0];
+			if (input) macros.push(input);
+		}
+	}
+	return macros;
+}
+
+function pointAt(text, index) {
+	const before = text.slice(0, index);
+	const row = (before.match(/\n/g) || []).length;
+	return { row, column: index - (before.lastIndexOf("\n") + 1) };
+}
+
+//inserts, deletes, or replaces one character, mostly with ones that are significant to the grammar
+const characters = "{}[]()|,:&;#?@%~=+-*/<>dkht0123456789 \n";
+function randomEdit(text) {
+	const index = random(text.length + 1);
+	const kind = index < text.length ? random(3) : 0;
+	const inserted = kind === 1 ? "" : characters[random(characters.length)];
+	const removed = kind === 0 ? 0 : 1;
+	const newText = text.slice(0, index) + inserted + text.slice(index + removed);
+	return {
+		newText,
+		edit: {
+			startIndex: index,
+			oldEndIndex: index + removed,
+			newEndIndex: index + inserted.length,
+			startPosition: pointAt(text, index),
+			oldEndPosition: pointAt(text, index + removed),
+			newEndPosition: pointAt(newText, index + inserted.length),
+		},
+	};
+}
+
+function elapsed(start) {
+	return Number(process.hrtime.bigint() - start) / 1e6;
+}
+
+function percentile(values, p) {
+	const sorted = values.slice().sort((a, b) => a - b);
+	return sorted[Math.min(sorted.length - 1, Math.floor(sorted.length * p))];
+}
+
+const parser = new Parser();
+parser.setLanguage(Roll20Script);
+
+let lexed = 0;
+function countLexed(message) {
+	if (message.startsWith("lexed_lookahead")) lexed++;
+}
+
+const incrementalTimes = [], fullTimes = [];
+let incrementalLexed = 0, fullLexed = 0, mismatches = 0;
+
+for (const macro of corpusMacros()) {
+	for (let i=0; i<editCount; i++) {
+		const { newText, edit } = randomEdit(macro);
+		
+		const oldTree = parser.parse(macro);
+		oldTree.edit(edit);
+		let start = process.hrtime.bigint();
+		const incremental = parser.parse(newText, oldTree);
+		incrementalTimes.push(elapsed(start));
+		
+		start = process.hrtime.bigint();
+		const full = parser.parse(newText);
+		fullTimes.push(elapsed(start));
+		
+		if (incremental.rootNode.toString() !== full.rootNode.toString()) {
+			if (mismatches++ < 5) console.log(`different trees after editing ${JSON.stringify(macro)} into ${JSON.stringify(newText)}`);
+		}
+		
+		//the same parses again, logged
+		const loggedTree = parser.parse(macro);
+		loggedTree.edit(edit);
+		parser.setLogger(countLexed);
+		lexed = 0;
+		parser.parse(newText, loggedTree);
+		incrementalLexed += lexed;
+		lexed = 0;
+		parser.parse(newText);
+		fullLexed += lexed;
+		parser.setLogger(null);
+	}
+}
+
+const report = (name, times) => console.log(`${name}: median ${percentile(times, 0.5).toFixed(3)} ms, `
+	+ `p99 ${percentile(times, 0.99).toFixed(3)} ms, max ${percentile(times, 1).toFixed(3)} ms`);
+console.log(`${incrementalTimes.length} edits`);
+report("incremental reparse", incrementalTimes);
+report("full reparse", fullTimes);
+console.log(`incremental reparses over 1 ms: ${incrementalTimes.filter(time => time > 1).length}`);
+console.log(`tokens not lexed again: ${(100 * (1 - incrementalLexed / fullLexed)).toFixed(1)}%`);
+console.log(`trees that differ from a full reparse: ${mismatches}`);
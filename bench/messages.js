@@ -0,0 +1,57 @@
+//Measures parsing a multi-line macro as the chat messages Roll20 would send it as (see parallel.js):
+// all of it, then again after one line is edited, when only that line's message is parsed again.
+//
+//Usage: node bench/messages.js [number of lines] [number of parses]
+
+const os = require("os");
+//as many of libuv's threads as there are CPUs, before the pool is started
+process.env.UV_THREADPOOL_SIZE = process.env.UV_THREADPOOL_SIZE || os.cpus().length;
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+const { parseMessages, MessageCache } = require("../parallel");
+
+const lineCount = Number(process.argv[2]) || 40;
+const parseCount = Number(process.argv[3]) || 50;
+
+function line(i, edit) {
+	switch (i % 4) {
+		case 0: return `/em swings at @{target|token_name} [[1d20+@{selected|str_mod}+${edit}]]`;
+		case 1: return `&{template:default} {{name=Attack ${i}}}`;
+		case 2: return `{{damage=[[?{Damage|2d6}+floor(@{selected|level}/2)+${edit}]]}} {{note=line ${i}}}`;
+		default: return `?{Target ${i}|Goblin,@{goblin|ac}|Orc,@{orc|ac}} misses by [[1d4]]`;
+	}
+}
+
+//each edit is different, so that it's never already cached
+function macro(edited, edit) {
+	const lines = [];
+	for (let i=0; i<lineCount; i++) lines.push(line(i, i === edited ? edit : 0));
+	return lines.join("\n");
+}
+
+async function time(name, each) {
+	const start = process.hrtime.bigint();
+	for (let i=0; i<parseCount; i++) await each(i);
+	const elapsed = Number(process.hrtime.bigint() - start) / 1e6 / parseCount;
+	console.log(`${name}: ${elapsed.toFixed(3)} ms/parse`);
+}
+
+async function main() {
+	const source = macro(-1, 0);
+	const threads = process.env.UV_THREADPOOL_SIZE;
+	console.log(`${lineCount} lines, ${source.length} characters, `
+		+ `${Roll20Script.splitMessages(source).length / 2} messages, ${threads} threads`);
+	
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	await time("whole macro as one script, one thread", () => parser.parse(source));
+	
+	await parseMessages(source, { cache: new MessageCache() });	//starts the thread pool
+	await time("messages, nothing cached", () => parseMessages(source, { cache: new MessageCache() }));
+	
+	const cache = new MessageCache();
+	await parseMessages(source, { cache });
+	await time("messages, one line edited", i => parseMessages(macro(i % lineCount, i+1), { cache }));
+}
+
+main();
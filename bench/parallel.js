@@ -0,0 +1,51 @@
+//Measures how long it takes to parse a long roll template macro (like those a character sheet
+// generates) on one thread, and split between its properties on several (see parallel.js).
+//
+//Usage: node bench/parallel.js [number of properties] [number of parses]
+
+const os = require("os");
+//as many of libuv's threads as there are CPUs, before the pool is started
+process.env.UV_THREADPOOL_SIZE = process.env.UV_THREADPOOL_SIZE || os.cpus().length;
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+const { parseTemplateParallel } = require("../parallel");
+
+const propertyCount = Number(process.argv[2]) || 1000;
+const parseCount = Number(process.argv[3]) || 20;
+
+//(a query that ends a property needs a space before the property's end, or "}}}" ends the property and
+// leaves the query open: the parts would have errors, and the macro would be parsed in one go)
+function sheetMacro(n) {
+	let macro = "&{template:atkdmg} {{mod=+5}} {{rname=Longsword}} ";
+	for (let i=0; i<n; i++) {
+		macro += `{{attack${i}=[[1d20+@{atk${i}}]] ?{Advantage|Normal,0|Advantage,1|Disadvantage,2} }} `;
+		macro += `{{damage${i}=[[?{Damage|2d6}+floor(@{dmg${i}}/2)]] [[{1d6,@{bonus${i}}}kh1]]}} `;
+	}
+	return macro;
+}
+
+async function main() {
+	const source = sheetMacro(propertyCount);
+	
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	parser.parse(source);
+	let start = process.hrtime.bigint();
+	for (let i=0; i<parseCount; i++) parser.parse(source);
+	const serial = Number(process.hrtime.bigint() - start) / 1e6 / parseCount;
+	console.log(`${source.length} characters, ${2*propertyCount + 2} properties`);
+	console.log(`one thread, tree-sitter tree: ${serial.toFixed(2)} ms/parse`);
+	
+	const counts = [1, 2, 4, 8, 16].filter(count => count <= process.env.UV_THREADPOOL_SIZE);
+	for (const threads of counts) {
+		await parseTemplateParallel(source, { threads });	//starts the thread pool
+		start = process.hrtime.bigint();
+		let result;
+		for (let i=0; i<parseCount; i++) result = await parseTemplateParallel(source, { threads });
+		const elapsed = Number(process.hrtime.bigint() - start) / 1e6 / parseCount;
+		console.log(`${threads} thread(s), flat tree: ${elapsed.toFixed(2)} ms/parse, ${result.parts} part(s), `
+			+ `${result.nodes.length / 4} nodes, ${(serial / elapsed).toFixed(2)}x`);
+	}
+}
+
+main();
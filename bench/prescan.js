@@ -0,0 +1,73 @@
+//Measures how much time the plain text pre-scan saves on a mix of chat messages like a game's chat
+// log: mostly plain text (some of it with chat commands or punctuation that looks like the start of
+// an element), some rolls and attributes, and some roll template macros.
+//
+//Usage: node bench/prescan.js [number of messages] [number of passes]
+
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+
+const messageCount = Number(process.argv[2]) || 20000;
+const passCount = Number(process.argv[3]) || 5;
+
+//a fixed seed, so that every run measures the same messages
+let seed = 1;
+function random(n) {
+	seed = seed * 48271 % 2147483647;
+	return seed % n;
+}
+function pick(array) {
+	return array[random(array.length)];
+}
+
+const words = ["the", "goblin", "swings", "at", "you", "and", "misses", "I", "cast", "fireball", "on", "it",
+	"does", "that", "hit", "nice", "roll", "lol", "wait", "who's", "turn", "is", "it", "100%", "{sic}", "@GM"];
+function sentence() {
+	let text = "";
+	for (let i=0, n=3+random(15); i<n; i++) text += (i ? " " : "") + pick(words);
+	return text + pick([".", "!", "?", "", "..."]);
+}
+
+function message() {
+	const kind = random(100);
+	if (kind < 55) return sentence();
+	if (kind < 65) return pick(["/w gm ", "/em ", "/ooc ", "/desc "]) + sentence();
+	if (kind < 75) return `@{selected|token_name} attacks! [[1d20+@{selected|str_mod}]] ${sentence()}`;
+	if (kind < 85) return pick(["/r 1d20+5", "/roll 2d6+3", "#Initiative", "Heals [[2d4+2]] HP."]);
+	if (kind < 95) return `&{template:default} {{name=${sentence()}}} {{attack=[[1d20+@{atk}]]}} `
+		+ `{{damage=[[?{Damage|2d6}+floor(@{level}/2)]]}}`;
+	return `?{Action|Attack,%{selected|attack}|Spell,%{selected|spell}|Say,${sentence()}}`;
+}
+
+const messages = [];
+for (let i=0; i<messageCount; i++) messages.push(message());
+const bytes = messages.reduce((sum, message) => sum + message.length, 0);
+
+const parser = new Parser();
+parser.setLanguage(Roll20Script);
+
+function time(name, each) {
+	each();	//warm up
+	const start = process.hrtime.bigint();
+	for (let i=0; i<passCount; i++) each();
+	const elapsed = Number(process.hrtime.bigint() - start) / 1e6 / passCount;
+	console.log(`${name}: ${elapsed.toFixed(2)} ms/pass, ${(elapsed * 1e6 / messages.length).toFixed(0)} ns/message`);
+	return elapsed;
+}
+
+let plain = 0;
+for (const message of messages) if (Roll20Script.prescan(message).script) plain++;
+console.log(`${messages.length} messages, ${bytes} characters, ${(100 * plain / messages.length).toFixed(1)}% plain`);
+
+const parseAll = time("parse every message", () => {
+	for (const message of messages) parser.parse(message);
+});
+time("pre-scan only", () => {
+	for (const message of messages) Roll20Script.prescan(message);
+});
+const prescanned = time("pre-scan, then parse the rest", () => {
+	for (const message of messages) {
+		if (!Roll20Script.prescan(message).script) parser.parse(message);
+	}
+});
+console.log(`speedup: ${(parseAll / prescanned).toFixed(2)}x`);
@@ -0,0 +1,58 @@
+//Measures how long short macros wait when they're parsed alongside very long ones: one after another
+// on one parser, and taking turns through the scheduler (see scheduler.js).
+//
+//Usage: node bench/scheduler.js [number of long macros] [number of short macros]
+
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+const { Scheduler } = require("../scheduler");
+
+const longCount = Number(process.argv[2]) || 4;
+const shortCount = Number(process.argv[3]) || 100;
+
+//deeply nested queries, which keep the parser busy
+function longMacro(n) {
+	let macro = "&{template:default} ";
+	for (let i=0; i<n; i++) macro += `{{q${i}=?{Choice|a,?{Inner&#124;x&#125;|b,?{Inner&#124;x&#44;1&#124;y&#44;2&#125;|c}}} `;
+	return macro;
+}
+const shortMacro = "/r 1d20+@{selected|str_mod} [[2d6]] ?{Bonus|0}";
+
+function median(values) {
+	return values.slice().sort((a, b) => a - b)[Math.floor(values.length / 2)];
+}
+
+async function main() {
+	const macros = [];
+	for (let i=0; i<longCount; i++) macros.push(longMacro(2000));
+	for (let i=0; i<shortCount; i++) macros.splice(Math.floor(i * macros.length / shortCount), 0, shortMacro);
+	
+	//one after another
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	let start = process.hrtime.bigint();
+	const serialWaits = [];
+	for (const macro of macros) {
+		parser.parse(macro);
+		if (macro === shortMacro) serialWaits.push(Number(process.hrtime.bigint() - start) / 1e6);
+	}
+	const serialTotal = Number(process.hrtime.bigint() - start) / 1e6;
+	
+	//taking turns
+	const scheduler = new Scheduler({ slice: 1000 });
+	start = process.hrtime.bigint();
+	const scheduledWaits = [];
+	await Promise.all(macros.map(macro => scheduler.parse(macro).then(() => {
+		if (macro === shortMacro) scheduledWaits.push(Number(process.hrtime.bigint() - start) / 1e6);
+	})));
+	const scheduledTotal = Number(process.hrtime.bigint() - start) / 1e6;
+	
+	console.log(`${longCount} long macros (${macros.find(macro => macro !== shortMacro).length} characters), `
+		+ `${shortCount} short ones`);
+	console.log(`one after another: short macros done after a median of ${median(serialWaits).toFixed(2)} ms, `
+		+ `all done after ${serialTotal.toFixed(2)} ms`);
+	console.log(`scheduled: short macros done after a median of ${median(scheduledWaits).toFixed(2)} ms, `
+		+ `all done after ${scheduledTotal.toFixed(2)} ms`);
+}
+
+main();
@@ -0,0 +1,31 @@
+//Measures the time from `require()`ing the parser to the end of its first parse, in fresh
+// processes (each sample is a new process, as with short-lived workers).
+//
+//Usage: node bench/startup.js [number of processes]
+
+const { execFileSync } = require("child_process");
+
+const processCount = Number(process.argv[2]) || 20;
+
+if (process.argv[2] === "--child") {
+	const start = process.hrtime.bigint();
+	
+	const Parser = require("tree-sitter");
+	const Roll20Script = require("../index");
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	parser.parse("/r 1d20+@{selected|str_mod} [[2d6]] ?{Bonus|0}");
+	
+	process.stdout.write(String(Number(process.hrtime.bigint() - start) / 1e6));
+}
+else {
+	const times = [];
+	for (let i=0; i<processCount; i++) {
+		times.push(Number(execFileSync(process.execPath, [__filename, "--child"], { encoding: "utf8" })));
+	}
+	times.sort((a, b) => a - b);
+	
+	const median = times[Math.floor(times.length / 2)];
+	console.log(`require() to first parse: median ${median.toFixed(3)} ms, `
+		+ `min ${times[0].toFixed(3)} ms, max ${times[times.length-1].toFixed(3)} ms (${times.length} processes)`);
+}
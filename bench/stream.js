@@ -0,0 +1,62 @@
+//Measures parsing an export file of macros (see stream.js): decoding the whole file into a string and
+// parsing each message of it, then parsing the messages where they are, from the mapped file.
+//
+//Usage: node bench/stream.js [number of lines]
+
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+const Parser = require("tree-sitter");
+const Roll20Script = require("../index");
+const { parseFile } = require("../stream");
+
+const lineCount = Number(process.argv[2]) || 200000;
+
+function line(i) {
+	switch (i % 4) {
+		case 0: return `/em swings at @{target|token_name} [[1d20+@{selected|str_mod}]] — ${i}`;
+		case 1: return `&{template:default} {{name=Attaque n° ${i}}}`;
+		case 2: return `{{damage=[[?{Dégâts|2d6}+floor(@{selected|level}/2)]]}} {{note=line ${i}}}`;
+		default: return `?{Target ${i}|Goblin,@{goblin|ac}|Orc,@{orc|ac}} misses by [[1d4]]`;
+	}
+}
+
+function time(name, run) {
+	const memory = process.memoryUsage().rss;
+	const start = process.hrtime.bigint();
+	return Promise.resolve(run()).then(count => {
+		const elapsed = Number(process.hrtime.bigint() - start) / 1e6;
+		const grown = (process.memoryUsage().rss - memory) / 1024 / 1024;
+		console.log(`${name}: ${count} messages, ${elapsed.toFixed(1)} ms, RSS grew by ${grown.toFixed(1)} MB`);
+	});
+}
+
+async function main() {
+	const file = path.join(os.tmpdir(), `roll20-script-bench-${process.pid}.txt`);
+	const lines = [];
+	for (let i=0; i<lineCount; i++) lines.push(line(i));
+	fs.writeFileSync(file, lines.join("\n"));
+	console.log(`${lineCount} lines, ${fs.statSync(file).size} bytes`);
+	
+	const parser = new Parser();
+	parser.setLanguage(Roll20Script);
+	
+	try {
+		await time("decoded into a string", () => {
+			const source = fs.readFileSync(file, "utf8");
+			const boundaries = Roll20Script.splitMessages(source);
+			for (let i = 0; i < boundaries.length; i += 2) parser.parse(source.slice(boundaries[i], boundaries[i+1]));
+			return boundaries.length / 2;
+		});
+		
+		await time("from the mapped file", async () => {
+			let count = 0;
+			for await (const message of parseFile(file, { trees: false })) count++;
+			return count;
+		});
+	} finally {
+		fs.unlinkSync(file);
+	}
+}
+
+main();
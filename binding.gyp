@@ -2,14 +2,20 @@
   "targets": [
     {
       "target_name": "tree_sitter_roll20_script_binding",
+      "variables": {
+        "tree_sitter_lib": "<!(node -p \"require('path').join(require('path').dirname(require.resolve('tree-sitter/package.json')), 'vendor', 'tree-sitter', 'lib')\")"
+      },
       "include_dirs": [
         "<!(node -e \"require('nan')\")",
+        "<(tree_sitter_lib)/include",
         "src"
       ],
       "sources": [
         "src/parser.c",
         "src/binding.cc",
-        "src/scanner.cc"
+        "src/scanner.cc",
+        "src/prescan.cc",
+        "<(tree_sitter_lib)/src/lib.c"
       ],
       "cflags_c": [
         "-std=c99",
@@ -36,13 +36,22 @@ module.exports = grammar({
 		$.__HTML_ENTITY,
 		
 		$.__AMPERSAND,			// &
+		
+		$.__TEXT,				// (plain text within nested elements)
+		
+		$.__DEFAULT_PIPE,		// | (a roll query's separator, if a default value follows it)
 	],
 	
 	extras: $ => [],
 	
 	//supertypes: $ => [],
 	
-	//inline: $ => [],
+	inline: $ => [
+		$._rt_element,
+		$._comparePoint,
+		$._modifier_comparator,
+		$._modifier_value,
+	],
 	
 	precedences: $ => [
 		/*[
@@ -51,10 +60,7 @@ module.exports = grammar({
 		],*/
 	],
 	
-	conflicts: $ => [
-		[ $.rollQuery, $._rq_option, ],
-		[ $.script, $.rollTemplate, ],
-	],
+	conflicts: $ => [],
 	
 	//word: $ => $.___,
 	
@@ -108,18 +114,30 @@ module.exports = grammar({
 			$.rollTemplate,
 		),
 		
+		//A script and a roll template can begin with the same elements, so both begin with
+		// `_script_common`. Which one it is gets decided at the first element they don't share.
+		_script: $ => choice(
+			$._script_common,
+			seq(
+				optional($._script_common),
+				alias($._script_text, $.text),
+				repeat(choice(
+					$._script_common1,
+					$._script_common2,
+					alias($._script_text, $.text),
+				)),
+			),
+		),
 		
-		_script: $ => repeat1(choice(
+		_script_common: $ => repeat1(choice(
 			$._script_common1,
 			$._script_common2,
-			//alias(/[^#&\s\]]/, $.string),
-			/[^#&\s\]]/,
 		)),
 		
 		_script_common1: $ => choice(
 			$._placeholder,	//attributes, abilities
 			$.rollQuery,
-			/\s/,
+			alias(/\s+/, $.text),
 		),
 		_script_common2: $ => choice(
 			$.inlineRoll,
@@ -137,6 +155,50 @@ module.exports = grammar({
 		htmlEntity: $ => $.__HTML_ENTITY,
 		
 		
+		/*┌──────────────────────────────
+		  │ Text
+		  └┬─────────────────────────────*/
+		 /*│ Plain text is matched as runs of characters, so each run is a single
+		   │   `text` node.
+		   │ 
+		   │ A run must not swallow the start of another element. The lexer
+		   │   only gives the external scanner a chance at the start of each
+		   │   token, so a run stops before:
+		   │ • hash characters, ampersands (HTML entities, flags), and closing
+		   │   square brackets.
+		   │ • the character sequences "@{", "%{", "?{", "{{", and "}}".
+		   │ • opening square brackets (inline rolls, labels).
+		   │ A lone "@", "%", "?", "[", "{", or "}" that doesn't start anything
+		   │   is a text node of its own.
+		   │ 
+		   │ Within roll queries, labels, table names, flags, and ability
+		   │   command buttons, whether a delimiter ends the element depends on
+		   │   how deeply it's nested, so the external scanner matches the runs
+		   │   there instead (`__TEXT`). Characters it leaves alone are matched
+		   │   one at a time.
+		   │ 
+		   │ A roll template may only contain whitespace between its elements,
+		   │   so whitespace on its own is also matched by `_script_common1`.
+		   │   That rule comes first in the grammar, so it wins when both match
+		   │   the same whitespace. A run can't start with a slash, which would
+		   │   start a roll command instead.
+		   └─────────────────────────────*/
+		
+		_script_text: $ => token(choice(
+			seq(
+				choice(
+					/[^#&\]?@%\[{}\/]/,
+					/[?@%{}][^#&\]?@%\[{}]/,
+				),
+				repeat(choice(
+					/[^#&\]?@%\[{}]/,
+					/[?@%{}][^#&\]?@%\[{}]/,
+				)),
+			),
+			/[?@%\[{}\/]/,
+		)),
+		
+		
 		/*╔════════════════════════════════════════════════════════════
 		  ║ Attributes (getters), Abilities (methods)
 		  ╚╤═══════════════════════════════════════════════════════════*/
@@ -316,15 +378,28 @@ module.exports = grammar({
 			alias($.__BUTTON_END, $.delimiter_end),
 		),
 		
-		_acb_identifier_text: $ => prec.right(repeat1(choice(
-			/[^#&|,})]/,
+		//The first character is never scanned as part of a run of text, so that "target" and
+		// "selected" can still be matched as character tokens.
+		_acb_identifier_text: $ => prec.right(seq(
+			choice(
+				alias(/[^#&|,})]/, $.text),
+				$._acb_identifier_text_2,
+			),
+			repeat(choice(
+				alias($.__TEXT, $.text),
+				alias(/[^#&|,})]/, $.text),
+				$._acb_identifier_text_2,
+			)),
+		)),
+		
+		_acb_identifier_text_2: $ => choice(
 			$.__COMMA,
 			$.__RIGHT_BRACE,
 			$.__RIGHT_PAREN,
 			$._placeholder,
 			$.hash,
 			$._htmlEntity_or_ampersand,
-		))),
+		),
 		
 		
 		/*╔════════════════════════════════════════════════════════════
@@ -569,7 +644,8 @@ module.exports = grammar({
 		
 		_label_text: $ => prec.right(seq(
 			choice(
-				/[^#&\[\]{|,}()]/,
+				alias($.__TEXT, $.text),
+				alias(/[^#&\[\]{|,}()]/, $.text),
 				$._placeholder,
 				$.hash,
 				$._htmlEntity_or_ampersand,
@@ -584,7 +660,8 @@ module.exports = grammar({
 		)),
 		
 		_label_text_2: $ => choice(
-			/[^#&\]{|,}()]/,
+			alias($.__TEXT, $.text),
+			alias(/[^#&\]{|,}()]/, $.text),
 			$._placeholder,
 			$.hash,
 			$._htmlEntity_or_ampersand,
@@ -626,7 +703,8 @@ module.exports = grammar({
 		  ║ Rolls
 		  ╚╤═══════════════════════════════════════════════════════════*/
 		 /*│ Roll modifiers can be injected with attributes, abilities, and
-		   │   inline rolls. This script does not parse the modifiers.
+		   │   inline rolls. Only the ones written out are typed (see Roll
+		   │   Modifiers below).
 		   └───────────────────────────────────────────────────────────*/
 		
 		/*┌──────────────────────────────
@@ -645,8 +723,25 @@ module.exports = grammar({
 		),
 		
 		_diceRoll_modifiers: $ => repeat1(choice(
+			$.keep_highest,
+			$.keep_lowest,
+			$.drop_highest,
+			$.drop_lowest,
+			$.reroll,
+			$.reroll_once,
+			$.explode,
+			$.compound,
+			$.penetrate,
+			$.success,
+			$.failure,
+			$.critical_success,
+			$.critical_failure,
+			$.sort_ascending,
+			$.sort_descending,
+			$.match,
+			$.match_total,
 			$._integer,
-			/[aAcCdDfFhHkKlLmMoOpPrRsStT<=>!]+/,
+			token(prec(-1, /[aAcCdDfFhHkKlLmMoOpPrRsStT<=>!]+/)),
 		)),
 		
 		
@@ -666,9 +761,82 @@ module.exports = grammar({
 		)),
 		
 		_groupRoll_modifiers: $ => repeat1(choice(
+			$.keep_highest,
+			$.keep_lowest,
+			$.drop_highest,
+			$.drop_lowest,
+			$.success,
+			$.failure,
 			$._integer,
-			/[dDfFhHkKlL<=>]+/,
+			token(prec(-1, /[dDfFhHkKlL<=>]+/)),
+		)),
+		
+		
+		/*┌──────────────────────────────
+		  │ Roll Modifiers
+		  └┬─────────────────────────────*/
+		 /*│ Each modifier is its own node, with fields for its comparator and
+		   │   value (or count) where it has them. The letters themselves are
+		   │   left out of the tree, since the node's type says what they were.
+		   │ • Keep/drop: k, kh, kl, d, dh, dl, then an optional count.
+		   │ • Reroll (r), reroll once (ro), failure (f), critical success
+		   │   (cs), critical failure (cf), explode (!), compound (!!),
+		   │   penetrate (!p): an optional compare point.
+		   │ • Success: a comparator and a value.
+		   │ • Sort: s, sa, sd.
+		   │ • Match (m) and match total (mt): an optional minimum group size,
+		   │   then an optional comparator and value.
+		   │ 
+		   │ A compare point is an optional comparator (`=` if there isn't
+		   │   one) followed by a value. Where a value could belong either to
+		   │   a modifier or to the next one (e.g., "!>5"), it belongs to the
+		   │   modifier. Anything else (e.g., letters combined with an
+		   │   attribute) is matched as before, as untyped text.
+		   │ 
+		   │ The untyped text has a lower lexical precedence, so wherever a
+		   │   modifier's letters match, they're lexed as that modifier even if
+		   │   no compare point follows (e.g., "1d6r"). So the compare point is
+		   │   optional for every modifier that takes one, as it was for the
+		   │   untyped text; otherwise those rolls would now be errors.
+		   └─────────────────────────────*/
+		
+		keep_highest: $ => prec.right(seq(/[kK][hH]?/, optional($._modifier_value))),
+		keep_lowest: $ => prec.right(seq(/[kK][lL]/, optional($._modifier_value))),
+		drop_highest: $ => prec.right(seq(/[dD][hH]/, optional($._modifier_value))),
+		drop_lowest: $ => prec.right(seq(/[dD][lL]?/, optional($._modifier_value))),
+		
+		reroll: $ => prec.right(seq(/[rR]/, optional($._comparePoint))),
+		reroll_once: $ => prec.right(seq(/[rR][oO]/, optional($._comparePoint))),
+		
+		explode: $ => prec.right(seq("!", optional($._comparePoint))),
+		compound: $ => prec.right(seq("!!", optional($._comparePoint))),
+		penetrate: $ => prec.right(seq(/![pP]/, optional($._comparePoint))),
+		
+		success: $ => seq($._modifier_comparator, $._modifier_value),
+		failure: $ => prec.right(seq(/[fF]/, optional($._comparePoint))),
+		critical_success: $ => prec.right(seq(/[cC][sS]/, optional($._comparePoint))),
+		critical_failure: $ => prec.right(seq(/[cC][fF]/, optional($._comparePoint))),
+		
+		sort_ascending: $ => /[sS][aA]?/,
+		sort_descending: $ => /[sS][dD]/,
+		
+		match: $ => prec.right(seq(
+			/[mM]/,
+			optional(field("count", alias($._integer, $.count))),
+			optional(seq($._modifier_comparator, $._modifier_value)),
 		)),
+		match_total: $ => prec.right(seq(
+			/[mM][tT]/,
+			optional(field("count", alias($._integer, $.count))),
+			optional(seq($._modifier_comparator, $._modifier_value)),
+		)),
+		
+		_comparePoint: $ => seq(
+			optional($._modifier_comparator),
+			$._modifier_value,
+		),
+		_modifier_comparator: $ => field("comparator", alias(/[<>=]/, $.comparator)),
+		_modifier_value: $ => field("value", alias($._integer, $.value)),
 		
 		
 		/*┌──────────────────────────────
@@ -698,6 +866,10 @@ module.exports = grammar({
 		   │   the identifier acts as the value as well. Which means that HTML
 		   │   entities in the identifier can be interpreted as characters in
 		   │   the value.
+		   │ • Whether the first separator is followed by a default value or by
+		   │   options depends on whether there's another separator after it,
+		   │   so the external scanner looks ahead and returns `__DEFAULT_PIPE`
+		   │   for the former.
 		   └───────────────────────────────────────────────────────────*/
 		
 		rollQuery: $ => seq(
@@ -706,24 +878,28 @@ module.exports = grammar({
 				alias($._rq_text_pd, $.prompt),
 				seq(
 					optional(alias($._rq_text_pd, $.prompt)),
-					alias($.__PIPE, $.separator),
-					optional(choice(
-						alias($._rq_text_pd, $.default_value),
+					choice(
+						seq(
+							alias($.__DEFAULT_PIPE, $.separator),
+							optional(alias($._rq_text_pd, $.default_value)),
+						),
 						seq(
+							alias($.__PIPE, $.separator),
 							optional(alias($._rq_option, $.option)),
 							repeat1(seq(
 								alias($.__PIPE, $.separator),
 								optional(alias($._rq_option, $.option)),
 							)),
 						),
-					)),
+					),
 				),
 			),
 			alias($.__ROLLQUERY_END, $.delimiter_end),
 		),
 		
 		_rq_text: $ => choice(
-			/[^#&{|,}()]/,
+			alias($.__TEXT, $.text),
+			alias(/[^#&{|,}()]/, $.text),
 			$._placeholder,
 			$.hash,
 			$._htmlEntity_or_ampersand,
@@ -766,7 +942,8 @@ module.exports = grammar({
 		   └───────────────────────────────────────────────────────────*/
 		
 		flag_value: $ => repeat1(choice(
-			/[^#&}]/,
+			alias($.__TEXT, $.text),
+			alias(/[^#&}]/, $.text),
 			$._placeholder,
 			$.hash,
 			$._htmlEntity_or_ampersand,
@@ -807,23 +984,31 @@ module.exports = grammar({
 		  ╚════════════════════════════════════════════════════════════*/
 		
 		rollTemplate: $ => seq(
-			repeat(choice(
-				$._script_common1,
-				$._script_common2,
-				alias($._rt_property, $.template_property),
-				field("rtype", alias($._rt_rtype, $.template_property)),
-				/\r?\n/,
+			optional(choice(
+				$._script_common,
+				seq(
+					optional($._script_common),
+					$._rt_element,
+					repeat(choice(
+						$._script_common1,
+						$._script_common2,
+						$._rt_element,
+					)),
+				),
 			)),
 			alias($._flag_rollTemplate, $.flag),
 			repeat(choice(
 				$._script_common1,
 				$._script_common2,
-				alias($._rt_property, $.template_property),
-				field("rtype", alias($._rt_rtype, $.template_property)),
-				/\r?\n/,
+				$._rt_element,
 			)),
 		),
 		
+		_rt_element: $ => choice(
+			alias($._rt_property, $.template_property),
+			field("rtype", alias($._rt_rtype, $.template_property)),
+		),
+		
 		_rt_property: $ => seq(
 			alias($.__ROLLTEMPLATE_PROPERTY_START, $.delimiter_start),
 			optional(alias($._rt_propertyName, $.property_identifier)),
@@ -832,17 +1017,23 @@ module.exports = grammar({
 			alias($.__ROLLTEMPLATE_PROPERTY_END, $.delimiter_end),
 		),
 		_rt_propertyName: $ => repeat1(choice(
-			/[^#&=}]|\r?\n/,
+			alias($._rt_propertyName_text, $.text),
 			$._placeholder,
 			$.hash,
 			$._htmlEntity_or_ampersand,
 			$.inlineRoll,
 			$.abilityCommandButton,
 		)),
-		_rt_propertyValue: $ => repeat1(prec.right(choice(
-			$._script,
-			/\r?\n/,
-		))),
+		_rt_propertyValue: $ => $._script,
+		
+		//runs stop before "@{", "%{", and opening square brackets (inline rolls, labels)
+		_rt_propertyName_text: $ => token(choice(
+			repeat1(choice(
+				/[^#&=}@%\[]/,
+				/[@%][^#&=}@%\[{]/,
+			)),
+			/[@%\[]/,
+		)),
 		
 		_rt_rtype: $ => prec.right(seq(
 			alias($._rt_rtype_attribute, $.attribute),
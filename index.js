@@ -8,6 +8,42 @@ try {
   }
 }
 
-try {
-  module.exports.nodeTypeInfo = require("./src/node-types.json");
-} catch (_) {}
+//node-types.json is only parsed the first time it's used, so that loading the parser stays cheap
+Object.defineProperty(module.exports, "nodeTypeInfo", {
+  configurable: true,
+  enumerable: true,
+  get() {
+    try {
+      return require("./src/node-types.json");
+    } catch (_) {}
+  },
+});
+
+//The script Roll20 parses once an option has been chosen: the option's value (an `option_value` node, or
+// its text), decoded once (see src/scanner_entities.h) and parsed from the top. The node's subtree isn't
+// that script's tree. Within a query, text is lexed a character at a time, a roll template's flag and
+// properties aren't grouped into a `rollTemplate`, and a roll command ("/r …") isn't recognized. So the
+// value is parsed again, like parseBatch's sources are. Positions are indices into `text`, the decoded
+// value. A value without entities isn't copied.
+module.exports.optionValueScript = function (optionValue) {
+  const value = typeof optionValue === "string" ? optionValue : optionValue.text;
+  const text = value.includes("&") ? module.exports.decodeEntities(value) : value;
+  const batch = module.exports.parseBatch([text], { trees: true });
+  return {
+    text,
+    hasError: batch.hasError[0] === 1,
+    nodes: batch.trees[0],
+    types: batch.types,
+  };
+};
+
+//Checks whether `source` is plain text without parsing it (see src/prescan.h). `offset` is the index of
+// the first character at which an element could start. If there isn't one, `script` is the trivial
+// result a parse would amount to (the whole source is text), and there's no need to parse it.
+module.exports.prescan = function (source) {
+  const offset = module.exports.findSyntax(source);
+  return {
+    offset,
+    script: offset < source.length ? null : { type: "script", text: source },
+  };
+};
@@ -0,0 +1,167 @@
+//Parses macros on several threads: a roll template macro with many properties split between them, or
+// a multi-line macro split into the chat messages Roll20 would send it as.
+//
+//Parses run on libuv's thread pool (see parseAsync in src/binding.cc), so as many run at once as it has
+// threads (UV_THREADPOOL_SIZE, 4 by default). Each one's tree is flattened there, into its named nodes.
+//
+//A roll template macro is split between its top-level properties (see findTemplateProperties in src/prescan.h),
+// and each part is parsed on its own, with the template's flag included in front of it. The parts' nodes
+// are stitched together in order into one flat tree:
+//
+//  {
+//    types: ["script", "rollTemplate", ...],
+//    nodes: Int32Array [type, startIndex, endIndex, parent, ...],  //4 per node, in document order
+//    hasError: false,
+//    parts: 8,
+//  }
+//
+//`parent` is the index of the parent node (-1 for the root). If any part doesn't parse cleanly, the
+// split can't be trusted, so the whole macro is parsed in one go instead, and `parts` is 1.
+//
+//A multi-line macro is split into messages (see splitMessages in src/prescan.h), and each message that
+// isn't already cached is parsed on its own. The flat trees ({ types, nodes, hasError }) are cached by
+// the message's text, so after an edit only the messages that changed are parsed again. Cached trees
+// are shared, so don't modify them.
+
+const Roll20Script = require("./index");
+
+const NODE_SIZE = 4;
+const THREADS = Number(process.env.UV_THREADPOOL_SIZE) || 4;
+
+//Parses a job on the thread pool. A job is { source, ranges, start, end }: the included ranges to parse
+// ([start, end, ...], or null for all of it), and the range of nodes to keep.
+function run({ source, ranges, start, end }) {
+  return new Promise((resolve, reject) => {
+    const options = { trees: true, ranges, keep: [start, end] };
+    Roll20Script.parseAsync(source, options, (error, tree) => {
+      if (error) reject(error);
+      else resolve({ types: tree.types, nodes: tree.nodes, hasError: tree.hasError });
+    });
+  });
+}
+
+//Splits the properties into at most as many parts as there are threads, of about the same length. The
+// first part starts at the beginning of the macro, and the last one ends at its end.
+function split(source, boundaries, threads) {
+  const flag = [boundaries[0], boundaries[1]];
+  const propertyEnds = [];
+  for (let i = 3; i < boundaries.length; i += 2) propertyEnds.push(boundaries[i]);
+
+  //each cut is at the property end closest to where it would be if the parts were the same length
+  const parts = [];
+  const target = (source.length - boundaries[1]) / threads;
+  let start = 0;
+  for (let i = 0; i < propertyEnds.length - 1 && parts.length < threads - 1; i++) {
+    const ideal = boundaries[1] + (parts.length + 1) * target;
+    if (Math.abs(propertyEnds[i] - ideal) > Math.abs(propertyEnds[i+1] - ideal)) continue;
+    parts.push({ ranges: [start, propertyEnds[i]], start, end: propertyEnds[i] });
+    start = propertyEnds[i];
+  }
+  parts.push({ ranges: [start, source.length], start, end: source.length });
+
+  //every part but the first is parsed after the flag
+  for (const part of parts.slice(1)) part.ranges.unshift(...flag);
+  return parts;
+}
+
+//Stitches the parts' nodes together. The first part has the root and the template (the root's only
+// child); the top-level nodes of the others are the template's children.
+function stitch(results, length) {
+  const types = [], typeIds = new Map();
+  const total = results.reduce((sum, result) => sum + result.nodes.length, 0);
+  const nodes = new Int32Array(total);
+  let offset = 0, template = -1;
+
+  for (const result of results) {
+    const ids = result.types.map(type => {
+      if (!typeIds.has(type)) {
+        typeIds.set(type, types.length);
+        types.push(type);
+      }
+      return typeIds.get(type);
+    });
+
+    const first = offset / NODE_SIZE;
+    for (let i = 0; i < result.nodes.length; i += NODE_SIZE) {
+      const parent = result.nodes[i+3];
+      nodes[offset] = ids[result.nodes[i]];
+      nodes[offset+1] = result.nodes[i+1];
+      nodes[offset+2] = result.nodes[i+2];
+      nodes[offset+3] = parent >= 0 ? first + parent : template;
+      offset += NODE_SIZE;
+    }
+
+    if (template < 0 && results.length > 1) {
+      //the first part ends early, but its root and template span the whole macro
+      template = first + 1;
+      nodes[2] = length;
+      nodes[template*NODE_SIZE + 2] = length;
+    }
+  }
+
+  return { types, nodes, hasError: results.some(result => result.hasError), parts: results.length };
+}
+
+async function parseTemplateParallel(source, { threads = THREADS } = {}) {
+  const boundaries = Roll20Script.findTemplateProperties(source);
+
+  if (threads > 1 && boundaries && boundaries.length >= 2 + 2*2) {
+    const parts = split(source, boundaries, threads);
+    if (parts.length > 1) {
+      const results = await Promise.all(parts.map(part => run({ source, ...part })));
+      if (!results.some(result => result.hasError)) return stitch(results, source.length);
+    }
+  }
+
+  const whole = await run({ source, ranges: null, start: 0, end: source.length });
+  return stitch([whole], source.length);
+}
+
+//least recently used trees are dropped first
+class MessageCache {
+  constructor(limit = 1000) {
+    this.limit = limit;
+    this.trees = new Map();
+  }
+  get(text) {
+    const tree = this.trees.get(text);
+    if (tree) {
+      this.trees.delete(text);
+      this.trees.set(text, tree);
+    }
+    return tree;
+  }
+  set(text, tree) {
+    this.trees.set(text, tree);
+    if (this.trees.size > this.limit) this.trees.delete(this.trees.keys().next().value);
+  }
+}
+
+const sharedCache = new MessageCache();
+
+//Returns one entry per message: { startIndex, endIndex, tree }. The tree's indices are relative to the
+// message's `startIndex`.
+async function parseMessages(source, { cache = sharedCache } = {}) {
+  const boundaries = Roll20Script.splitMessages(source);
+  const messages = [];
+  for (let i = 0; i < boundaries.length; i += 2) {
+    const text = source.slice(boundaries[i], boundaries[i+1]);
+    messages.push({ startIndex: boundaries[i], endIndex: boundaries[i+1], text, tree: cache.get(text) });
+  }
+
+  //the messages that aren't cached are all queued at once
+  const texts = [...new Set(messages.filter(message => !message.tree).map(message => message.text))];
+  const results = await Promise.all(texts.map(text => run({ source: text, ranges: null, start: 0, end: text.length })));
+
+  const parsed = new Map();
+  texts.forEach((text, i) => {
+    parsed.set(text, results[i]);
+    cache.set(text, results[i]);
+  });
+
+  return messages.map(({ startIndex, endIndex, text, tree }) => ({
+    startIndex, endIndex, tree: tree || parsed.get(text),
+  }));
+}
+
+module.exports = { parseTemplateParallel, parseMessages, MessageCache };
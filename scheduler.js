@@ -0,0 +1,57 @@
+//Parses untrusted macros without letting any one of them block the others (or the event loop).
+//
+//Each parse runs on libuv's thread pool (see parseAsync in src/binding.cc), in short slices, using the
+// parser's timeout: when a slice runs out, tree-sitter stops where it is, and the parse goes to the back
+// of the pool's queue, to be resumed from there on its next turn. A parse that needs many slices is
+// preempted each time, so short parses finish first. As many parses run at once as the pool has threads
+// (UV_THREADPOOL_SIZE, 4 by default).
+//
+//A parse can have a deadline (`timeout`, in milliseconds, from when it's scheduled) and an AbortSignal.
+// If it's still running when the deadline passes or the signal is aborted, it's stopped (an aborted one
+// through the parser's cancellation flag, even in the middle of a slice), and its promise is rejected
+// with an error whose `code` is "ETIMEDOUT" or "ABORT_ERR".
+//
+//  const scheduler = new Scheduler({ slice: 1000 });
+//  const { hasError, types, nodes } = await scheduler.parse(macro, { timeout: 50, signal });
+//
+//The result is the macro's flattened tree, as from parseAsync: { hasError, startIndex, endIndex,
+// nodeCount, types, nodes }.
+
+const Roll20Script = require("./index");
+
+class Scheduler {
+  //`slice`: how long each turn can run, in microseconds
+  //`trees`: whether to flatten the trees, or only count their named nodes
+  constructor({ slice = 1000, trees = true } = {}) {
+    this.slice = slice;
+    this.trees = trees;
+  }
+
+  parse(source, { timeout = Infinity, signal = null } = {}) {
+    return new Promise((resolve, reject) => {
+      if (signal && signal.aborted) {
+        reject(abortError());
+        return;
+      }
+
+      let onAbort = null;
+      const id = Roll20Script.parseAsync(source, { slice: this.slice, timeout, trees: this.trees }, (error, tree) => {
+        if (onAbort) signal.removeEventListener("abort", onAbort);
+        if (error) reject(error);
+        else resolve(tree);
+      });
+      if (signal) {
+        onAbort = () => Roll20Script.cancelParse(id);
+        signal.addEventListener("abort", onAbort, { once: true });
+      }
+    });
+  }
+}
+
+function abortError() {
+  const error = new Error("The parse was cancelled");
+  error.code = "ABORT_ERR";
+  return error;
+}
+
+module.exports = { Scheduler };
@@ -1,6 +1,26 @@
-#include "tree_sitter/parser.h"
+#include "tree_sitter/api.h"
+#include "prescan.h"
+#include "scanner_entities.h"
 #include <node.h>
+#include <node_buffer.h>
 #include "nan.h"
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#ifndef _WIN32
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 using namespace v8;
 
@@ -10,6 +30,691 @@ namespace {
 
 NAN_METHOD(New) {}
 
+//The UTF-16 code units of a string, which are what its indices count. Most messages are short enough
+// to be copied to the stack.
+class Utf16 {
+ public:
+  explicit Utf16(Local<String> string) : length(string->Length()), data(small) {
+    if (length > 512) {
+      large.resize(length);
+      data = large.data();
+    }
+    string->Write(Isolate::GetCurrent(), data, 0, length, String::NO_NULL_TERMINATION);
+  }
+
+  uint32_t length;
+  uint16_t *data;
+
+ private:
+  uint16_t small[512];
+  std::vector<uint16_t> large;
+};
+
+//[start, end, start, end, ...]
+Local<Array> RangesToArray(const std::vector<Roll20ScriptRange> &ranges) {
+  Local<Array> array = Nan::New<Array>(2 * ranges.size());
+  for (uint32_t i = 0; i < ranges.size(); i++) {
+    Nan::Set(array, 2*i, Nan::New<Number>(ranges[i].start));
+    Nan::Set(array, 2*i + 1, Nan::New<Number>(ranges[i].end));
+  }
+  return array;
+}
+
+uint32_t FindSyntaxIn(const char *text, uint32_t length) {
+  return tree_sitter_roll20_script_find_syntax(text, length);
+}
+uint32_t FindSyntaxIn(const uint16_t *text, uint32_t length) {
+  return tree_sitter_roll20_script_find_syntax_utf16(text, length);
+}
+
+uint32_t SplitMessagesIn(const char *text, uint32_t length, Roll20ScriptRange *messages, uint32_t capacity) {
+  return tree_sitter_roll20_script_split_messages(text, length, messages, capacity);
+}
+uint32_t SplitMessagesIn(const uint16_t *text, uint32_t length, Roll20ScriptRange *messages, uint32_t capacity) {
+  return tree_sitter_roll20_script_split_messages_utf16(text, length, messages, capacity);
+}
+
+//findSyntax(source): see prescan.h. `source` is a string or a Buffer (e.g., UTF-8), and the result is
+// an index into it.
+NAN_METHOD(FindSyntax) {
+  if (node::Buffer::HasInstance(info[0])) {
+    uint32_t offset = FindSyntaxIn(node::Buffer::Data(info[0]), node::Buffer::Length(info[0]));
+    info.GetReturnValue().Set(Nan::New<Number>(offset));
+    return;
+  }
+  Utf16 text(Nan::To<String>(info[0]).ToLocalChecked());
+  info.GetReturnValue().Set(Nan::New<Number>(FindSyntaxIn(text.data, text.length)));
+}
+
+//findTemplateProperties(source): see prescan.h. Returns the start and end indices of the flag followed
+// by those of each property, or null if there's no flag.
+NAN_METHOD(FindTemplateProperties) {
+  Utf16 text(Nan::To<String>(info[0]).ToLocalChecked());
+
+  Roll20ScriptRange flag;
+  std::vector<Roll20ScriptRange> properties(64);
+  uint32_t count = tree_sitter_roll20_script_find_template_properties_utf16(
+    text.data, text.length, &flag, properties.data(), properties.size());
+  if (count > properties.size()) {
+    properties.resize(count);
+    tree_sitter_roll20_script_find_template_properties_utf16(
+      text.data, text.length, &flag, properties.data(), properties.size());
+  }
+  if (flag.end == 0) {
+    info.GetReturnValue().SetNull();
+    return;
+  }
+
+  properties.resize(count);
+  properties.insert(properties.begin(), flag);
+  info.GetReturnValue().Set(RangesToArray(properties));
+}
+
+template <typename Char>
+Local<Array> SplitMessagesOf(const Char *text, uint32_t length) {
+  std::vector<Roll20ScriptRange> messages(64);
+  uint32_t count = SplitMessagesIn(text, length, messages.data(), messages.size());
+  if (count > messages.size()) {
+    messages.resize(count);
+    SplitMessagesIn(text, length, messages.data(), messages.size());
+  }
+
+  messages.resize(count);
+  return RangesToArray(messages);
+}
+
+//splitMessages(source): see prescan.h. Returns the start and end indices of each message. `source` is a
+// string or a Buffer (e.g., UTF-8), and the indices are into it.
+NAN_METHOD(SplitMessages) {
+  if (node::Buffer::HasInstance(info[0])) {
+    info.GetReturnValue().Set(SplitMessagesOf(node::Buffer::Data(info[0]), node::Buffer::Length(info[0])));
+    return;
+  }
+  Utf16 text(Nan::To<String>(info[0]).ToLocalChecked());
+  info.GetReturnValue().Set(SplitMessagesOf(text.data, text.length));
+}
+
+//decodeEntities(text): see scanner_entities.h. Returns the text with its entities decoded once.
+NAN_METHOD(DecodeEntities) {
+  Nan::Utf8String text(info[0]);
+  std::string decoded(text.length(), '\0');
+  decoded.resize(tree_sitter_roll20_script_decode_entities(*text, text.length(), &decoded[0]));
+  info.GetReturnValue().Set(Nan::New(decoded).ToLocalChecked());
+}
+
+#ifndef _WIN32
+struct Mapping {
+  void *address;
+  size_t length;
+};
+
+void Unmap(char *, void *hint) {
+  Mapping *mapping = static_cast<Mapping *>(hint);
+  munmap(mapping->address, mapping->length);
+  delete mapping;
+}
+
+//mapFile(path, offset, length): a Buffer over part of a file, which is mapped into memory instead of
+// being read. The mapping is read-only (don't write to the Buffer), and it's unmapped when the Buffer is
+// garbage collected. The Buffer is shorter than `length` if the file ends first.
+NAN_METHOD(MapFile) {
+  Nan::Utf8String path(info[0]);
+  double offset = Nan::To<double>(info[1]).FromMaybe(0);
+  double length = Nan::To<double>(info[2]).FromMaybe(0);
+
+  int fd = open(*path, O_RDONLY | O_CLOEXEC);
+  struct stat status;
+  if (fd < 0 || fstat(fd, &status) != 0) {
+    int error = errno;
+    if (fd >= 0) close(fd);
+    Isolate::GetCurrent()->ThrowException(Nan::ErrnoException(error, "open", nullptr, *path));
+    return;
+  }
+
+  if (!(offset >= 0 && offset < status.st_size && length > 0)) {
+    close(fd);
+    info.GetReturnValue().Set(Nan::NewBuffer(0).ToLocalChecked());
+    return;
+  }
+  if (length > status.st_size - offset) length = status.st_size - offset;
+
+  //a mapping has to start at a page boundary
+  off_t start = off_t(offset);
+  off_t pageStart = start - start % sysconf(_SC_PAGESIZE);
+  size_t before = start - pageStart;
+  Mapping *mapping = new Mapping{nullptr, before + size_t(length)};
+  mapping->address = mmap(nullptr, mapping->length, PROT_READ, MAP_PRIVATE, fd, pageStart);
+  int error = errno;
+  close(fd);
+  if (mapping->address == MAP_FAILED) {
+    delete mapping;
+    Isolate::GetCurrent()->ThrowException(Nan::ErrnoException(error, "mmap", nullptr, *path));
+    return;
+  }
+  madvise(mapping->address, mapping->length, MADV_SEQUENTIAL);
+
+  char *data = static_cast<char *>(mapping->address) + before;
+  info.GetReturnValue().Set(Nan::NewBuffer(data, size_t(length), Unmap, mapping).ToLocalChecked());
+}
+#endif
+
+//A parser for the grammar. If the runtime can't load the language (i.e., src/parser.c was generated for
+// an ABI version it doesn't support), throws a JS error and returns null.
+TSParser *NewParser() {
+  const TSLanguage *language = tree_sitter_roll20_script();
+  TSParser *parser = ts_parser_new();
+  if (!ts_parser_set_language(parser, language)) {
+    ts_parser_delete(parser);
+    std::string message = "the tree-sitter runtime (ABI version " + std::to_string(TREE_SITTER_LANGUAGE_VERSION)
+      + ") can't load the language (ABI version " + std::to_string(ts_language_version(language))
+      + "); regenerate src/parser.c with a matching tree-sitter-cli";
+    Nan::ThrowError(message.c_str());
+    return nullptr;
+  }
+  return parser;
+}
+
+//Counts the named nodes of a tree. If `nodes` isn't null, they're also flattened into it in document
+// order, 4 per node: [type, startIndex, endIndex, parent], as in parallel.js. The type is the node's
+// symbol, and `parent` is the index of the parent node (-1 for the root). `unit` is the size of a code
+// unit in bytes, so that indices count the same units as the source's.
+//
+//Only the nodes within [keepStart, keepEnd) are kept. The children of a node that's only partly within
+// it (e.g., the root, when part of a macro is parsed with included ranges) get its parent.
+uint32_t Flatten(const TSTree *tree, uint32_t unit, std::vector<int32_t> *nodes,
+    uint32_t keepStart = 0, uint32_t keepEnd = UINT32_MAX) {
+  TSTreeCursor cursor = ts_tree_cursor_new(ts_tree_root_node(tree));
+  std::vector<int32_t> parents;
+  int32_t parent = -1;
+  uint32_t count = 0;
+
+  for (;;) {
+    TSNode node = ts_tree_cursor_current_node(&cursor);
+    uint32_t start = ts_node_start_byte(node) / unit, end = ts_node_end_byte(node) / unit;
+    int32_t index = parent;
+    if (ts_node_is_named(node) && start >= keepStart && end <= keepEnd) {
+      index = count++;
+      if (nodes) {
+        nodes->push_back(ts_node_symbol(node));
+        nodes->push_back(start);
+        nodes->push_back(end);
+        nodes->push_back(parent);
+      }
+    }
+
+    if (end > keepStart && start < keepEnd && ts_tree_cursor_goto_first_child(&cursor)) {
+      parents.push_back(parent);
+      parent = index;
+      continue;
+    }
+    while (!ts_tree_cursor_goto_next_sibling(&cursor)) {
+      if (!ts_tree_cursor_goto_parent(&cursor)) {
+        ts_tree_cursor_delete(&cursor);
+        return count;
+      }
+      parent = parents.back();
+      parents.pop_back();
+    }
+  }
+}
+
+template <typename T, typename ArrayType>
+Local<ArrayType> NewTypedArray(const std::vector<T> &values) {
+  Local<ArrayBuffer> buffer = ArrayBuffer::New(Isolate::GetCurrent(), values.size() * sizeof(T));
+  Local<ArrayType> array = ArrayType::New(buffer, 0, values.size());
+  if (!values.empty()) {
+    Nan::TypedArrayContents<T> contents(array);
+    memcpy(*contents, values.data(), values.size() * sizeof(T));
+  }
+  return array;
+}
+
+//A parsed tree, flattened (see Flatten) so that it can be handed to JS without a tree object.
+struct FlatTree {
+  bool hasError = true;
+  uint32_t startIndex = 0, endIndex = 0;  //the root node's
+  uint32_t nodeCount = 0;
+  std::vector<int32_t> nodes;  //only if they were asked for
+};
+
+//Flattens `tree` and deletes it.
+void FlattenTree(TSTree *tree, uint32_t unit, bool trees, FlatTree *flat,
+    uint32_t keepStart = 0, uint32_t keepEnd = UINT32_MAX) {
+  TSNode root = ts_tree_root_node(tree);
+  flat->hasError = ts_node_has_error(root);
+  flat->startIndex = ts_node_start_byte(root) / unit;
+  flat->endIndex = ts_node_end_byte(root) / unit;
+  flat->nodeCount = Flatten(tree, unit, trees ? &flat->nodes : nullptr, keepStart, keepEnd);
+  ts_tree_delete(tree);
+}
+
+//{ hasError, startIndex, endIndex, nodeCount, nodes? }
+Local<Object> FlatTreeObject(const FlatTree &flat, bool trees) {
+  Local<Object> result = Nan::New<Object>();
+  Nan::Set(result, Nan::New("hasError").ToLocalChecked(), Nan::New<Boolean>(flat.hasError));
+  Nan::Set(result, Nan::New("startIndex").ToLocalChecked(), Nan::New<Number>(flat.startIndex));
+  Nan::Set(result, Nan::New("endIndex").ToLocalChecked(), Nan::New<Number>(flat.endIndex));
+  Nan::Set(result, Nan::New("nodeCount").ToLocalChecked(), Nan::New<Number>(flat.nodeCount));
+  if (trees) Nan::Set(result, Nan::New("nodes").ToLocalChecked(), NewTypedArray<int32_t, Int32Array>(flat.nodes));
+  return result;
+}
+
+//The name of each symbol, which is what a flattened node's type is the index of. Only built for the
+// language's `types`, the first time they're read (see Init).
+Local<Array> SymbolNames() {
+  const TSLanguage *language = tree_sitter_roll20_script();
+  uint32_t symbolCount = ts_language_symbol_count(language);
+  Local<Array> types = Nan::New<Array>(symbolCount);
+  for (uint32_t symbol = 0; symbol < symbolCount; symbol++) {
+    Nan::Set(types, symbol, Nan::New(ts_language_symbol_name(language, symbol)).ToLocalChecked());
+  }
+  return types;
+}
+
+void GetTypes(Local<Name>, const PropertyCallbackInfo<Value> &info) {
+  info.GetReturnValue().Set(SymbolNames());
+}
+
+//The language's `types`. The methods that need them are given the language as their data (see Init).
+Local<Value> LanguageTypes(Local<Value> language) {
+  return Nan::Get(language.As<Object>(), Nan::New("types").ToLocalChecked()).ToLocalChecked();
+}
+
+//parseBatch(sources, { trees }): parses each source (a string or a Buffer, e.g., UTF-8) with one parser,
+// without creating a tree object for any of them. Returns
+//
+//  {
+//    hasError: Uint8Array [1 if the tree has an error, ...],
+//    spans: Uint32Array [startIndex, endIndex, ...],  //the root node's
+//    nodeCounts: Uint32Array [number of named nodes, ...],
+//    types: ["script", ...],  //the language's `types` (the name of each symbol), if `trees`
+//    trees: [Int32Array, ...],  //the flattened named nodes of each tree, if `trees` (see Flatten)
+//  }
+//
+//Indices are into the source, as for findSyntax. If a source can't be parsed at all (e.g., it's not a
+// string or a Buffer), its span is [0, 0] and it has an error.
+NAN_METHOD(ParseBatch) {
+  if (info.Length() < 1 || !info[0]->IsArray()) {
+    Nan::ThrowTypeError("parseBatch() takes an array of strings or Buffers");
+    return;
+  }
+  Local<Array> sources = Local<Array>::Cast(info[0]);
+  TSParser *parser = NewParser();
+  if (!parser) return;
+
+  bool trees = false;
+  if (info.Length() > 1 && info[1]->IsObject()) {
+    Local<Value> option = Nan::Get(info[1].As<Object>(), Nan::New("trees").ToLocalChecked()).ToLocalChecked();
+    trees = Nan::To<bool>(option).FromMaybe(false);
+  }
+
+  const uint32_t count = sources->Length();
+  std::vector<uint8_t> hasError(count, 1);
+  std::vector<uint32_t> spans(2 * count, 0), nodeCounts(count, 0);
+  Local<Array> flatTrees = Nan::New<Array>(trees ? count : 0);
+  std::vector<int32_t> nodes;
+
+  for (uint32_t i = 0; i < count; i++) {
+    Local<Value> source = Nan::Get(sources, i).ToLocalChecked();
+    TSTree *tree = nullptr;
+    uint32_t unit = 1;
+    ts_parser_reset(parser);
+    if (node::Buffer::HasInstance(source)) {
+      tree = ts_parser_parse_string_encoding(parser, nullptr,
+        node::Buffer::Data(source), node::Buffer::Length(source), TSInputEncodingUTF8);
+    }
+    else if (source->IsString()) {
+      Utf16 text(source.As<String>());
+      unit = 2;
+      tree = ts_parser_parse_string_encoding(parser, nullptr,
+        reinterpret_cast<const char *>(text.data), text.length * unit, TSInputEncodingUTF16);
+    }
+
+    nodes.clear();
+    if (tree) {
+      TSNode root = ts_tree_root_node(tree);
+      hasError[i] = ts_node_has_error(root);
+      spans[2*i] = ts_node_start_byte(root) / unit;
+      spans[2*i + 1] = ts_node_end_byte(root) / unit;
+      nodeCounts[i] = Flatten(tree, unit, trees ? &nodes : nullptr);
+      ts_tree_delete(tree);
+    }
+    if (trees) Nan::Set(flatTrees, i, NewTypedArray<int32_t, Int32Array>(nodes));
+  }
+
+  ts_parser_delete(parser);
+
+  Local<Object> result = Nan::New<Object>();
+  Nan::Set(result, Nan::New("hasError").ToLocalChecked(), NewTypedArray<uint8_t, Uint8Array>(hasError));
+  Nan::Set(result, Nan::New("spans").ToLocalChecked(), NewTypedArray<uint32_t, Uint32Array>(spans));
+  Nan::Set(result, Nan::New("nodeCounts").ToLocalChecked(), NewTypedArray<uint32_t, Uint32Array>(nodeCounts));
+  if (trees) {
+    Nan::Set(result, Nan::New("types").ToLocalChecked(), LanguageTypes(info.Data()));
+    Nan::Set(result, Nan::New("trees").ToLocalChecked(), flatTrees);
+  }
+  info.GetReturnValue().Set(result);
+}
+
+//Idle parsers, which parses on the thread pool take and put back (on a JS thread, since a parser that
+// can't load the language throws there). A few are kept, so that a parse doesn't have to create one.
+const size_t MAX_IDLE_PARSERS = 8;
+std::mutex idleParsersMutex;
+std::vector<TSParser *> idleParsers;
+
+TSParser *TakeParser() {
+  {
+    std::lock_guard<std::mutex> lock(idleParsersMutex);
+    if (!idleParsers.empty()) {
+      TSParser *parser = idleParsers.back();
+      idleParsers.pop_back();
+      return parser;
+    }
+  }
+  return NewParser();
+}
+
+void PutBackParser(TSParser *parser) {
+  ts_parser_reset(parser);
+  ts_parser_set_included_ranges(parser, nullptr, 0);
+  ts_parser_set_cancellation_flag(parser, nullptr);
+  ts_parser_set_timeout_micros(parser, 0);
+  std::lock_guard<std::mutex> lock(idleParsersMutex);
+  if (idleParsers.size() < MAX_IDLE_PARSERS) idleParsers.push_back(parser);
+  else ts_parser_delete(parser);
+}
+
+typedef std::chrono::steady_clock Clock;
+
+struct AsyncParse;
+
+//the parses that haven't finished, by id, so that they can be cancelled
+std::mutex asyncParsesMutex;
+std::map<uint32_t, AsyncParse *> asyncParses;
+uint32_t nextAsyncParseId = 0;
+
+//A parse on the thread pool (see ParseAsync). It's only used by one thread at a time: the pool's while a
+// slice runs, and the JS thread between slices. Its cancellation flag is the exception.
+struct AsyncParse {
+  explicit AsyncParse(TSParser *parser) : parser(parser) {
+    std::lock_guard<std::mutex> lock(asyncParsesMutex);
+    id = nextAsyncParseId++;
+    asyncParses[id] = this;
+  }
+
+  ~AsyncParse() {
+    {
+      std::lock_guard<std::mutex> lock(asyncParsesMutex);
+      asyncParses.erase(id);
+    }
+    PutBackParser(parser);
+  }
+
+  uint32_t id;
+  TSParser *parser;
+
+  //A string's code units are copied, since it can't be read off the JS thread. A Buffer is read where
+  // it is, and kept alive until the parse is done.
+  std::vector<uint16_t> text;
+  Nan::Global<Object> buffer;
+  const char *data = nullptr;
+  uint32_t length = 0;
+  uint32_t unit = 1;
+
+  uint64_t slice = 0;  //microseconds, or 0 for the whole parse in one go
+  bool hasDeadline = false;
+  Clock::time_point deadline;
+  bool trees = false;
+  Nan::Global<Value> types;  //the language's, if `trees`
+  uint32_t keepStart = 0, keepEnd = UINT32_MAX;
+
+  //Set by cancelParse(). The parser checks it as it goes (see ts_parser_set_cancellation_flag), so a
+  // slice stops soon after it's set.
+  std::atomic<size_t> cancelled{0};
+
+  bool done = false;
+  bool timedOut = false;
+  FlatTree result;
+};
+
+static_assert(sizeof(std::atomic<size_t>) == sizeof(size_t), "the parser reads the cancellation flag as a size_t");
+
+Local<Value> ParseError(const char *message, const char *code) {
+  Local<Value> error = Nan::Error(message);
+  Nan::Set(error.As<Object>(), Nan::New("code").ToLocalChecked(), Nan::New(code).ToLocalChecked());
+  return error;
+}
+
+//Runs one slice of a parse on the thread pool. If the parse doesn't finish, it's queued again for its next
+// slice, behind whatever was queued in the meantime, so a long parse doesn't hold a thread while shorter
+// ones wait.
+//Parses only [start, end, start, end, ...] of the source (indices into it, in order), e.g., to parse part
+// of a macro with its context. The runtime needs the ranges' points as well.
+void SetIncludedRanges(AsyncParse *parse, Local<Array> indices) {
+  std::vector<TSRange> ranges(indices->Length() / 2);
+  TSPoint point = {0, 0};
+  uint32_t index = 0;
+  auto advance = [&](uint32_t to) {
+    for (to = std::min(to, parse->length); index < to; index++) {
+      bool newline = parse->unit == 2 ? parse->text[index] == '\n' : parse->data[index] == '\n';
+      if (newline) point = {point.row + 1, 0};
+      else point.column += parse->unit;
+    }
+    return index;
+  };
+
+  for (uint32_t i = 0; i < ranges.size(); i++) {
+    double start = Nan::To<double>(Nan::Get(indices, 2*i).ToLocalChecked()).FromMaybe(0);
+    double end = Nan::To<double>(Nan::Get(indices, 2*i + 1).ToLocalChecked()).FromMaybe(0);
+    ranges[i].start_byte = advance(start > 0 ? uint32_t(std::min(start, double(UINT32_MAX))) : 0) * parse->unit;
+    ranges[i].start_point = point;
+    ranges[i].end_byte = advance(end > 0 ? uint32_t(std::min(end, double(UINT32_MAX))) : 0) * parse->unit;
+    ranges[i].end_point = point;
+  }
+  ts_parser_set_included_ranges(parse->parser, ranges.data(), ranges.size());
+}
+
+class ParseWorker : public Nan::AsyncWorker {
+ public:
+  ParseWorker(Nan::Callback *callback, std::unique_ptr<AsyncParse> parse)
+    : Nan::AsyncWorker(callback, "roll20_script:parseAsync"), parse(std::move(parse)) {}
+
+  void Execute() override {
+    AsyncParse &parse = *this->parse;
+    if (parse.cancelled.load()) return;
+
+    uint64_t timeout = parse.slice;
+    if (parse.hasDeadline) {
+      int64_t remaining = std::chrono::duration_cast<std::chrono::microseconds>(parse.deadline - Clock::now()).count();
+      if (remaining <= 0) {
+        parse.timedOut = true;
+        return;
+      }
+      if (timeout == 0 || uint64_t(remaining) < timeout) timeout = remaining;
+    }
+
+    //out of time or cancelled, the parser stops where it is, and it resumes from there when it's called
+    // again with the same source
+    ts_parser_set_timeout_micros(parse.parser, timeout);
+    ts_parser_set_cancellation_flag(parse.parser, reinterpret_cast<const size_t *>(&parse.cancelled));
+    TSTree *tree = ts_parser_parse_string_encoding(parse.parser, nullptr, parse.data, parse.length * parse.unit,
+      parse.unit == 2 ? TSInputEncodingUTF16 : TSInputEncodingUTF8);
+    if (!tree) return;
+
+    parse.done = true;
+    FlattenTree(tree, parse.unit, parse.trees, &parse.result, parse.keepStart, parse.keepEnd);
+  }
+
+  void HandleOKCallback() override {
+    Nan::HandleScope scope;
+    if (parse->done) {
+      Local<Object> result = FlatTreeObject(parse->result, parse->trees);
+      if (parse->trees) Nan::Set(result, Nan::New("types").ToLocalChecked(), Nan::New(parse->types));
+      Local<Value> argv[] = { Nan::Null(), result };
+      callback->Call(2, argv, async_resource);
+    }
+    else if (parse->cancelled.load()) {
+      Local<Value> argv[] = { ParseError("The parse was cancelled", "ABORT_ERR") };
+      callback->Call(1, argv, async_resource);
+    }
+    else if (parse->timedOut) {
+      Local<Value> argv[] = { ParseError("The parse didn't finish before its deadline", "ETIMEDOUT") };
+      callback->Call(1, argv, async_resource);
+    }
+    else {
+      //the callback goes with the parse to its next slice
+      Nan::AsyncQueueWorker(new ParseWorker(callback, std::move(parse)));
+      callback = nullptr;
+    }
+  }
+
+ private:
+  std::unique_ptr<AsyncParse> parse;
+};
+
+//parseAsync(source, { slice, timeout, trees, ranges, keep }, callback): parses `source` (a string or a
+// Buffer, e.g., UTF-8) on libuv's thread pool, and returns an id for cancelParse(). Calls back with
+//
+//  {
+//    hasError: false,
+//    startIndex: 0, endIndex: 42,  //the root node's
+//    nodeCount: 12,  //the number of named nodes
+//    types: ["script", ...],  //if `trees`, as for parseBatch
+//    nodes: Int32Array [type, startIndex, endIndex, parent, ...],  //if `trees` (see Flatten)
+//  }
+//
+//`slice` is how long the parse can run before it lets another have the thread, in microseconds (0 for no
+// limit), and `timeout` is how long it can take in all, in milliseconds from now. If it runs out of time
+// or it's cancelled, the callback gets an error whose `code` is "ETIMEDOUT" or "ABORT_ERR".
+//
+//`ranges` is [start, end, ...]: the included ranges to parse, if not all of it (see SetIncludedRanges).
+// `keep` is [start, end]: the range of nodes to keep, if not all of them (see Flatten).
+NAN_METHOD(ParseAsync) {
+  if (info.Length() < 3 || !info[2]->IsFunction()) {
+    Nan::ThrowTypeError("parseAsync() takes a source, options, and a callback");
+    return;
+  }
+  bool isBuffer = node::Buffer::HasInstance(info[0]);
+  if (!isBuffer && !info[0]->IsString()) {
+    Nan::ThrowTypeError("parseAsync() parses a string or a Buffer");
+    return;
+  }
+
+  TSParser *parser = TakeParser();
+  if (!parser) return;
+  std::unique_ptr<AsyncParse> parse(new AsyncParse(parser));
+
+  if (isBuffer) {
+    parse->buffer.Reset(info[0].As<Object>());
+    parse->data = node::Buffer::Data(info[0]);
+    parse->length = node::Buffer::Length(info[0]);
+  }
+  else {
+    Local<String> string = info[0].As<String>();
+    parse->length = string->Length();
+    parse->unit = 2;
+    parse->text.resize(parse->length);
+    string->Write(Isolate::GetCurrent(), parse->text.data(), 0, parse->length, String::NO_NULL_TERMINATION);
+    parse->data = reinterpret_cast<const char *>(parse->text.data());
+  }
+
+  if (info[1]->IsObject()) {
+    Local<Object> options = info[1].As<Object>();
+    Local<Value> slice = Nan::Get(options, Nan::New("slice").ToLocalChecked()).ToLocalChecked();
+    Local<Value> timeout = Nan::Get(options, Nan::New("timeout").ToLocalChecked()).ToLocalChecked();
+    if (slice->IsNumber() && slice.As<Number>()->Value() >= 1) parse->slice = uint64_t(slice.As<Number>()->Value());
+    if (timeout->IsNumber() && std::isfinite(timeout.As<Number>()->Value())) {
+      double milliseconds = std::max(timeout.As<Number>()->Value(), 0.0);
+      parse->hasDeadline = true;
+      parse->deadline = Clock::now() + std::chrono::microseconds(int64_t(milliseconds * 1000));
+    }
+    Local<Value> trees = Nan::Get(options, Nan::New("trees").ToLocalChecked()).ToLocalChecked();
+    parse->trees = Nan::To<bool>(trees).FromMaybe(false);
+    if (parse->trees) parse->types.Reset(LanguageTypes(info.Data()));
+
+    Local<Value> ranges = Nan::Get(options, Nan::New("ranges").ToLocalChecked()).ToLocalChecked();
+    if (ranges->IsArray()) SetIncludedRanges(parse.get(), ranges.As<Array>());
+    Local<Value> keep = Nan::Get(options, Nan::New("keep").ToLocalChecked()).ToLocalChecked();
+    if (keep->IsArray()) {
+      parse->keepStart = Nan::To<uint32_t>(Nan::Get(keep.As<Object>(), 0).ToLocalChecked()).FromMaybe(0);
+      parse->keepEnd = Nan::To<uint32_t>(Nan::Get(keep.As<Object>(), 1).ToLocalChecked()).FromMaybe(UINT32_MAX);
+    }
+  }
+
+  uint32_t id = parse->id;
+  Nan::AsyncQueueWorker(new ParseWorker(new Nan::Callback(info[2].As<Function>()), std::move(parse)));
+  info.GetReturnValue().Set(Nan::New<Number>(id));
+}
+
+//cancelParse(id): stops a parse started by parseAsync(), whose callback then gets an "ABORT_ERR" error.
+// Does nothing if it has already called back. Throws a TypeError if `id` isn't a number (rather than
+// cancelling parse 0).
+NAN_METHOD(CancelParse) {
+  if (info.Length() < 1 || !info[0]->IsNumber()) {
+    Nan::ThrowTypeError("cancelParse() takes the id that parseAsync() returned");
+    return;
+  }
+  uint32_t id = Nan::To<uint32_t>(info[0]).FromMaybe(0);
+  std::lock_guard<std::mutex> lock(asyncParsesMutex);
+  auto parse = asyncParses.find(id);
+  if (parse != asyncParses.end()) parse->second->cancelled.store(1);
+}
+
+//bytes[start, end) of a Buffer, which the parser reads where they are
+struct ByteInput {
+  const char *data;
+  uint32_t length;
+};
+
+const char *ReadBytes(void *payload, uint32_t byte, TSPoint, uint32_t *bytesRead) {
+  const ByteInput *input = static_cast<const ByteInput *>(payload);
+  if (byte >= input->length) {
+    *bytesRead = 0;
+    return "";
+  }
+  *bytesRead = input->length - byte;
+  return input->data + byte;
+}
+
+//an index into `length` bytes, or `fallback` if it isn't a number
+size_t ByteIndex(Local<Value> value, size_t fallback, size_t length) {
+  if (!value->IsNumber()) return fallback;
+  double index = value.As<Number>()->Value();
+  return index > 0 ? size_t(std::min(index, double(length))) : 0;
+}
+
+//parseBytes(buffer, start, end, { trees }): parses buffer[start, end) as UTF-8, without copying or
+// decoding it. Returns its flattened tree, as for parseAsync but without `types` (they're the
+// language's `types`), with byte offsets from `start`.
+NAN_METHOD(ParseBytes) {
+  if (!node::Buffer::HasInstance(info[0])) {
+    Nan::ThrowTypeError("parseBytes() parses a Buffer");
+    return;
+  }
+  size_t length = node::Buffer::Length(info[0]);
+  size_t start = ByteIndex(info[1], 0, length);
+  size_t end = std::max(ByteIndex(info[2], length, length), start);
+  if (end - start > UINT32_MAX) {
+    Nan::ThrowError("parseBytes() can't parse more than 4 GB at once");
+    return;
+  }
+  bool trees = false;
+  if (info.Length() > 3 && info[3]->IsObject()) {
+    Local<Value> option = Nan::Get(info[3].As<Object>(), Nan::New("trees").ToLocalChecked()).ToLocalChecked();
+    trees = Nan::To<bool>(option).FromMaybe(false);
+  }
+
+  TSParser *parser = TakeParser();
+  if (!parser) return;
+  ByteInput bytes = {node::Buffer::Data(info[0]) + start, uint32_t(end - start)};
+  TSInput input = {&bytes, ReadBytes, TSInputEncodingUTF8};
+  TSTree *tree = ts_parser_parse(parser, nullptr, input);
+  PutBackParser(parser);
+
+  FlatTree flat;
+  if (tree) FlattenTree(tree, 1, trees, &flat);
+  info.GetReturnValue().Set(FlatTreeObject(flat, trees));
+}
+
 void Init(Local<Object> exports, Local<Object> module) {
   Local<FunctionTemplate> tpl = Nan::New<FunctionTemplate>(New);
   tpl->SetClassName(Nan::New("Language").ToLocalChecked());
@@ -20,9 +725,26 @@ void Init(Local<Object> exports, Local<Object> module) {
   Nan::SetInternalFieldPointer(instance, 0, tree_sitter_roll20_script());
 
   Nan::Set(instance, Nan::New("name").ToLocalChecked(), Nan::New("roll20_script").ToLocalChecked());
+  Nan::SetMethod(instance, "findSyntax", FindSyntax);
+  Nan::SetMethod(instance, "findTemplateProperties", FindTemplateProperties);
+  Nan::SetMethod(instance, "splitMessages", SplitMessages);
+  Nan::SetMethod(instance, "decodeEntities", DecodeEntities);
+  Nan::SetMethod(instance, "parseBatch", ParseBatch, instance);
+  Nan::SetMethod(instance, "parseAsync", ParseAsync, instance);
+  Nan::SetMethod(instance, "cancelParse", CancelParse);
+  Nan::SetMethod(instance, "parseBytes", ParseBytes);
+  //built the first time they're read, and then kept as a plain property, so that loading the parser stays
+  // cheap (as for index.js's nodeTypeInfo)
+  instance->SetLazyDataProperty(Nan::GetCurrentContext(), Nan::New("types").ToLocalChecked(), GetTypes).FromJust();
+#ifndef _WIN32
+  Nan::SetMethod(instance, "mapFile", MapFile);
+#endif
   Nan::Set(module, Nan::New("exports").ToLocalChecked(), instance);
 }
 
-NODE_MODULE(tree_sitter_roll20_script_binding, Init)
-
 }  // namespace
+
+//context aware, so that worker threads can load it too
+NODE_MODULE_INIT() {
+  Init(exports, Local<Object>::Cast(module));
+}
@@ -0,0 +1,509 @@
+#include "prescan.h"
+#include <atomic>	//atomic
+#include <cstdint>	//uint8_t, uint16_t, uint32_t
+#include <cstddef>	//size_t
+#include <type_traits>	//make_unsigned
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define ROLL20_SCRIPT_PRESCAN_SSE2
+	#include <emmintrin.h>
+	#if defined(__GNUC__)
+		//AVX2 is only used where the CPU has it, so it's compiled for just those functions
+		#define ROLL20_SCRIPT_PRESCAN_AVX2
+		#include <immintrin.h>
+		#define TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#endif
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+namespace {
+
+using namespace std;
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Characters
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Each character that can start an element is checked along with the one
+   │   after it (0 at the end of the text).
+   │
+   │ The vector versions only look for candidates: a byte that, with its
+   │   0x20 bit set, is one of "#%&?`{}". That covers all of "#&[]?@%{}"
+   │   in seven comparisons, plus a few characters that aren't ("`" and
+   │   some control characters), so each candidate is then checked here.
+   └─────────────────────────────*/
+
+//"#%&?" and "@[]{}", as bits of the low and high halves of ASCII
+const uint64_t CANDIDATES_LOW = 1ull<<'#' | 1ull<<'%' | 1ull<<'&' | 1ull<<'?';
+const uint64_t CANDIDATES_HIGH = 1ull<<('@'-64) | 1ull<<('['-64) | 1ull<<(']'-64) | 1ull<<('{'-64) | 1ull<<('}'-64);
+
+inline bool isCandidate(uint32_t c) {
+	return c < 64 ? CANDIDATES_LOW >> c & 1 : c < 128 && CANDIDATES_HIGH >> (c-64) & 1;
+}
+
+inline bool startsElement(uint32_t c, uint32_t next) {
+	switch (c) {
+		case '#': case '&': case '[': case ']':
+			return true;
+		case '?': case '@': case '%': case '{':
+			return next == '{';
+		case '}':
+			return next == '}';
+		default:
+			return false;
+	}
+}
+
+template <typename Char>
+inline uint32_t unit(Char c) {
+	return static_cast<typename make_unsigned<Char>::type>(c);
+}
+
+template <typename Char>
+inline bool startsElementAt(const Char *text, size_t i, size_t length) {
+	return startsElement(unit(text[i]), i+1 < length ? unit(text[i+1]) : 0);
+}
+
+inline unsigned lowestBit(uint32_t mask) {
+#if defined(_MSC_VER)
+	unsigned long index;
+	_BitScanForward(&index, mask);
+	return index;
+#else
+	return __builtin_ctz(mask);
+#endif
+}
+
+//Checks the candidates in `mask` (one bit per character, starting at `i`) in order.
+template <typename Char>
+inline bool findInMask(const Char *text, size_t i, size_t length, uint32_t mask, size_t &found) {
+	for (; mask; mask &= mask - 1) {
+		size_t j = i + lowestBit(mask);
+		if (startsElementAt(text, j, length)) {
+			found = j;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Scalar
+  ╚════════════════════════════════════════════════════════════*/
+
+template <typename Char>
+size_t findScalar(const Char *text, size_t i, size_t length) {
+	for (; i<length; i++) {
+		if (isCandidate(unit(text[i])) && startsElementAt(text, i, length)) return i;
+	}
+	return length;
+}
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ SSE2
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ 16 characters at a time. UTF-16 code units are packed into bytes first;
+   │   packing saturates, so a unit above 0xFF becomes 0 or 0xFF, neither of
+   │   which is a candidate.
+   │
+   │ Unless the text is shorter than a vector, the last partial vector is
+   │   loaded so that it ends with the text, overlapping the one before it,
+   │   and the characters that were already checked are shifted out of its
+   │   mask.
+   └─────────────────────────────*/
+
+#ifdef ROLL20_SCRIPT_PRESCAN_SSE2
+
+inline __m128i load16(const char *text) {
+	return _mm_loadu_si128(reinterpret_cast<const __m128i *>(text));
+}
+inline __m128i load16(const uint16_t *text) {
+	return _mm_packus_epi16(
+		_mm_loadu_si128(reinterpret_cast<const __m128i *>(text)),
+		_mm_loadu_si128(reinterpret_cast<const __m128i *>(text + 8))
+	);
+}
+
+inline uint32_t candidates16(__m128i v) {
+	__m128i f = _mm_or_si128(v, _mm_set1_epi8(0x20));
+	__m128i m = _mm_cmpeq_epi8(f, _mm_set1_epi8('#'));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('%')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('&')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('?')));
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('`')));	//@
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('{')));	//[ {
+	m = _mm_or_si128(m, _mm_cmpeq_epi8(f, _mm_set1_epi8('}')));	//] }
+	return _mm_movemask_epi8(m);
+}
+
+template <typename Char>
+size_t findSSE2(const Char *text, size_t i, size_t length) {
+	if (length < 16) return findScalar(text, i, length);
+	
+	size_t found;
+	for (; i+16 <= length; i += 16) {
+		if (findInMask(text, i, length, candidates16(load16(text + i)), found)) return found;
+	}
+	if (i < length) {
+		size_t last = length - 16;
+		if (findInMask(text, i, length, candidates16(load16(text + last)) >> (i - last), found)) return found;
+	}
+	return length;
+}
+
+#endif
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ AVX2
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ 32 characters at a time, ending the same way as the SSE2 version.
+   │   Packing works within each 128-bit lane, so the packed UTF-16 units
+   │   are put back in order afterward.
+   │
+   │ Text shorter than a vector goes to the SSE2 version, before any AVX2
+   │   instruction runs (mixing them costs more than it saves).
+   └─────────────────────────────*/
+
+#ifdef ROLL20_SCRIPT_PRESCAN_AVX2
+
+TARGET_AVX2 inline __m256i load32(const char *text) {
+	return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(text));
+}
+TARGET_AVX2 inline __m256i load32(const uint16_t *text) {
+	__m256i packed = _mm256_packus_epi16(
+		_mm256_loadu_si256(reinterpret_cast<const __m256i *>(text)),
+		_mm256_loadu_si256(reinterpret_cast<const __m256i *>(text + 16))
+	);
+	return _mm256_permute4x64_epi64(packed, 0xD8);
+}
+
+TARGET_AVX2 inline uint32_t candidates32(__m256i v) {
+	__m256i f = _mm256_or_si256(v, _mm256_set1_epi8(0x20));
+	__m256i m = _mm256_cmpeq_epi8(f, _mm256_set1_epi8('#'));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('%')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('&')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('?')));
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('`')));	//@
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('{')));	//[ {
+	m = _mm256_or_si256(m, _mm256_cmpeq_epi8(f, _mm256_set1_epi8('}')));	//] }
+	return _mm256_movemask_epi8(m);
+}
+
+//`length` is at least 32.
+template <typename Char>
+TARGET_AVX2 size_t findAVX2(const Char *text, size_t length) {
+	size_t i = 0, found;
+	for (; i+32 <= length; i += 32) {
+		if (findInMask(text, i, length, candidates32(load32(text + i)), found)) return found;
+	}
+	if (i < length) {
+		size_t last = length - 32;
+		if (findInMask(text, i, length, candidates32(load32(text + last)) >> (i - last), found)) return found;
+	}
+	return length;
+}
+
+#endif
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Dispatch
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ The CPU is checked the first time a pre-scan runs. Threads that race to
+   │   do it all get the same answer.
+   └─────────────────────────────*/
+
+enum Level {
+	UNKNOWN,
+	SCALAR,
+	SSE2,
+	AVX2,
+};
+
+atomic<int> level(UNKNOWN);
+
+Level detectLevel() {
+#if defined(ROLL20_SCRIPT_PRESCAN_AVX2)
+	if (__builtin_cpu_supports("avx2")) return AVX2;
+#endif
+#if defined(ROLL20_SCRIPT_PRESCAN_SSE2)
+	return SSE2;
+#else
+	return SCALAR;
+#endif
+}
+
+Level currentLevel() {
+	int current = level.load(memory_order_relaxed);
+	if (current == UNKNOWN) {
+		current = detectLevel();
+		level.store(current, memory_order_relaxed);
+	}
+	return static_cast<Level>(current);
+}
+
+template <typename Char>
+size_t findSyntax(const Char *text, size_t length) {
+	//a roll command can only be the whole script
+	if (length >= 2 && text[0] == '/' && text[1] == 'r') return 0;
+	
+	switch (currentLevel()) {
+#if defined(ROLL20_SCRIPT_PRESCAN_AVX2)
+		case AVX2:
+			if (length >= 32) return findAVX2(text, length);
+			return findSSE2(text, size_t(0), length);
+#endif
+#if defined(ROLL20_SCRIPT_PRESCAN_SSE2)
+		case SSE2: return findSSE2(text, size_t(0), length);
+#endif
+		default: return findScalar(text, size_t(0), length);
+	}
+}
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Roll Template Properties
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Only raw delimiters are tracked. At the top level of a roll template,
+   │   any delimiter that belongs to a nested element is encoded, so an
+   │   entity can't open or close anything the properties' boundaries
+   │   depend on.
+   │ 
+   │ Braces only nest within inline rolls (group rolls); elsewhere a lone
+   │   brace is text. Anything deeper than the stack can hold stops the
+   │   search, since the boundaries after it can't be trusted.
+   └─────────────────────────────*/
+
+enum Closer : uint8_t {
+	BRACE,			// }
+	BRACKET,		// ]
+	DOUBLE_BRACKET,	// ]]
+};
+
+const unsigned MAX_PROPERTY_NESTING = 64;
+
+template <typename Char>
+bool startsWith(const Char *text, size_t i, size_t length, const char *prefix) {
+	for (; *prefix; i++, prefix++) {
+		if (i >= length || unit(text[i]) != uint32_t(uint8_t(*prefix))) return false;
+	}
+	return true;
+}
+
+template <typename Char>
+struct TemplateTracker {
+	
+	enum Event {
+		NONE,
+		FLAG_END,
+		PROPERTY_END,
+	};
+	
+	const Char *text;
+	size_t length;
+	
+	Closer stack[MAX_PROPERTY_NESTING];
+	unsigned depth = 0, inlineRolls = 0;
+	bool inProperty = false, inFlag = false, foundFlag = false, overflowed = false;
+	size_t start = 0;	//of the flag or property being tracked
+	
+	TemplateTracker(const Char *text, size_t length) : text(text), length(length) {}
+	
+	//whether the text at `i` is still within a property or another element
+	bool isOpen() const {
+		return inProperty || depth > 0;
+	}
+	
+	bool push(Closer closer) {
+		if (depth == MAX_PROPERTY_NESTING) {
+			overflowed = true;
+			return false;
+		}
+		stack[depth++] = closer;
+		return true;
+	}
+	
+	//Moves past the delimiter or character at `i`, and returns the index after it.
+	size_t step(size_t i, Event &event) {
+		uint32_t c = unit(text[i]);
+		uint32_t next = i+1 < length ? unit(text[i+1]) : 0;
+		event = NONE;
+		
+		if (depth == 0 && c == '{' && next == '{' && !inProperty) {
+			inProperty = true;
+			start = i;
+			return i+2;
+		}
+		if (depth == 0 && c == '}' && next == '}' && inProperty) {
+			inProperty = false;
+			event = PROPERTY_END;
+			return i+2;
+		}
+		
+		if ((c == '?' || c == '@' || c == '%' || c == '&') && next == '{') {
+			if (c == '&' && depth == 0 && !inProperty && !foundFlag && startsWith(text, i+2, length, "template:")) {
+				inFlag = true;
+				start = i;
+			}
+			push(BRACE);
+			return i+2;
+		}
+		if (c == '[') {
+			if (next == '[') {
+				if (push(DOUBLE_BRACKET)) inlineRolls++;
+				return i+2;
+			}
+			push(BRACKET);
+		}
+		else if (c == '{' && inlineRolls > 0) {
+			push(BRACE);
+		}
+		else if (c == ']' && depth > 0) {
+			if (stack[depth-1] == DOUBLE_BRACKET && next == ']') {
+				depth--;
+				inlineRolls--;
+				return i+2;
+			}
+			if (stack[depth-1] == BRACKET) depth--;
+		}
+		else if (c == '}' && depth > 0 && stack[depth-1] == BRACE) {
+			depth--;
+			if (inFlag && depth == 0) {
+				inFlag = false;
+				foundFlag = true;
+				event = FLAG_END;
+			}
+		}
+		return i+1;
+	}
+};
+
+template <typename Char>
+uint32_t findTemplateProperties(const Char *text, size_t length,
+	Roll20ScriptRange *flag, Roll20ScriptRange *properties, uint32_t capacity)
+{
+	TemplateTracker<Char> tracker(text, length);
+	typename TemplateTracker<Char>::Event event;
+	uint32_t count = 0;
+	
+	*flag = Roll20ScriptRange{0, 0};
+	
+	for (size_t i = 0; i < length && !tracker.overflowed; ) {
+		i = tracker.step(i, event);
+		
+		if (event == tracker.FLAG_END) {
+			*flag = Roll20ScriptRange{uint32_t(tracker.start), uint32_t(i)};
+		}
+		else if (event == tracker.PROPERTY_END && tracker.foundFlag) {
+			if (count < capacity) properties[count] = Roll20ScriptRange{uint32_t(tracker.start), uint32_t(i)};
+			count++;
+		}
+	}
+	
+	return tracker.foundFlag ? count : 0;
+}
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Chat Messages
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Roll20 sends each line of a macro as its own message, except that a
+   │   roll template continues onto the next line while one of its
+   │   properties (or anything else) is still open, or if the next line
+   │   starts with another property.
+   │ 
+   │ Each message is tracked the same way as the properties above, so an
+   │   element left open at the end of a line that isn't part of a roll
+   │   template doesn't carry over to the next message.
+   └─────────────────────────────*/
+
+template <typename Char>
+bool startsWithProperty(const Char *text, size_t i, size_t length) {
+	while (i < length && (text[i] == ' ' || text[i] == '\t')) i++;
+	return startsWith(text, i, length, "{{");
+}
+
+template <typename Char>
+bool isBlank(const Char *text, size_t start, size_t end) {
+	for (size_t i = start; i < end; i++) {
+		if (text[i] != ' ' && text[i] != '\t' && text[i] != '\r' && text[i] != '\n') return false;
+	}
+	return true;
+}
+
+template <typename Char>
+uint32_t splitMessages(const Char *text, size_t length, Roll20ScriptRange *messages, uint32_t capacity) {
+	uint32_t count = 0;
+	
+	size_t i = 0;
+	while (i <= length) {
+		TemplateTracker<Char> tracker(text, length);
+		typename TemplateTracker<Char>::Event event;
+		size_t start = i, end = length;
+		
+		while (i < length) {
+			if (text[i] == '\n') {
+				bool continues = tracker.foundFlag && !tracker.overflowed
+					&& (tracker.isOpen() || startsWithProperty(text, i+1, length));
+				if (!continues) {
+					end = i > start && text[i-1] == '\r' ? i-1 : i;
+					break;
+				}
+			}
+			i = tracker.step(i, event);
+		}
+		
+		//blank lines aren't sent
+		if (!isBlank(text, start, end)) {
+			if (count < capacity) messages[count] = Roll20ScriptRange{uint32_t(start), uint32_t(end)};
+			count++;
+		}
+		i++;	//past the line break
+	}
+	
+	return count;
+}
+
+}	//namespace
+
+
+extern "C" {
+
+uint32_t tree_sitter_roll20_script_find_syntax(const char *text, uint32_t length) {
+	return findSyntax(text, length);
+}
+
+uint32_t tree_sitter_roll20_script_find_syntax_utf16(const uint16_t *text, uint32_t length) {
+	return findSyntax(text, length);
+}
+
+uint32_t tree_sitter_roll20_script_find_template_properties(const char *text, uint32_t length,
+	Roll20ScriptRange *flag, Roll20ScriptRange *properties, uint32_t capacity)
+{
+	return findTemplateProperties(text, length, flag, properties, capacity);
+}
+
+uint32_t tree_sitter_roll20_script_find_template_properties_utf16(const uint16_t *text, uint32_t length,
+	Roll20ScriptRange *flag, Roll20ScriptRange *properties, uint32_t capacity)
+{
+	return findTemplateProperties(text, length, flag, properties, capacity);
+}
+
+uint32_t tree_sitter_roll20_script_split_messages(const char *text, uint32_t length,
+	Roll20ScriptRange *messages, uint32_t capacity)
+{
+	return splitMessages(text, length, messages, capacity);
+}
+
+uint32_t tree_sitter_roll20_script_split_messages_utf16(const uint16_t *text, uint32_t length,
+	Roll20ScriptRange *messages, uint32_t capacity)
+{
+	return splitMessages(text, length, messages, capacity);
+}
+
+}	//extern "C"
@@ -0,0 +1,79 @@
+#ifndef TREE_SITTER_ROLL20_SCRIPT_PRESCAN_H_
+#define TREE_SITTER_ROLL20_SCRIPT_PRESCAN_H_
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Plain text pre-scan
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Most chat messages are plain text. Finding that out by parsing them
+   │ means building a tree and calling the external scanner for each token,
+   │ so this checks for the characters that can start an element instead,
+   │ many at a time (with SSE2 or AVX2 where the CPU has them).
+   │
+   │ An element can only start at:
+   │ • a hash character, an ampersand, or a square bracket.
+   │ • "?{", "@{", "%{", "{{", or "}}".
+   │ • "/r" at the very beginning (a roll command).
+   │
+   │ If there's none of those, the script is plain: a parse would produce
+   │ nothing but `text` nodes. Otherwise everything before the offset is
+   │ plain text, which a caller that only cares about elements can skip.
+   └───────────────────────────────────────────────────────────*/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Returns the offset (in code units) of the first character at which an element could start, or
+// `length` if the script is plain.
+uint32_t tree_sitter_roll20_script_find_syntax(const char *text, uint32_t length);
+uint32_t tree_sitter_roll20_script_find_syntax_utf16(const uint16_t *text, uint32_t length);
+
+/*┌──────────────────────────────
+  │ Roll template properties
+  └┬─────────────────────────────*/
+ /*│ A roll template with hundreds of properties can be split between them
+   │ and each part parsed on its own (e.g., on separate threads), with the
+   │ template's flag in front of it so that it's still a roll template.
+   │ The scanner's state between top-level properties is always the initial
+   │ state, so nothing else has to carry over from one part to the next.
+   │
+   │ The search only follows raw delimiters, so it can be fooled by
+   │ malformed macros. Check that the parts parse without errors, and parse
+   │ the whole macro if they don't.
+   └───────────────────────────────────────────────────────────*/
+
+typedef struct {
+  uint32_t start;
+  uint32_t end;
+} Roll20ScriptRange;
+
+//Finds the roll template's flag ("&{template:…}") and the top-level properties ("{{…}}") after it.
+// Returns the number of properties (only the first `capacity` are stored), or 0 if there's no flag.
+uint32_t tree_sitter_roll20_script_find_template_properties(const char *text, uint32_t length,
+  Roll20ScriptRange *flag, Roll20ScriptRange *properties, uint32_t capacity);
+uint32_t tree_sitter_roll20_script_find_template_properties_utf16(const uint16_t *text, uint32_t length,
+  Roll20ScriptRange *flag, Roll20ScriptRange *properties, uint32_t capacity);
+
+/*┌──────────────────────────────
+  │ Chat messages
+  └┬─────────────────────────────*/
+ /*│ Roll20 sends each line of a macro as its own chat message, except where
+   │ a roll template continues onto the next line (a property is still open
+   │ at the end of the line, or the next line starts with a property). Each
+   │ message can be parsed on its own.
+   └───────────────────────────────────────────────────────────*/
+
+//Finds the messages a macro is sent as, without their line breaks. Blank lines are skipped. Returns
+// the number of messages (only the first `capacity` are stored).
+uint32_t tree_sitter_roll20_script_split_messages(const char *text, uint32_t length,
+  Roll20ScriptRange *messages, uint32_t capacity);
+uint32_t tree_sitter_roll20_script_split_messages_utf16(const uint16_t *text, uint32_t length,
+  Roll20ScriptRange *messages, uint32_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_ROLL20_SCRIPT_PRESCAN_H_
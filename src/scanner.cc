@@ -1,44 +1,40 @@
 #include <tree_sitter/parser.h>
-#include <string>	//string, to_string
-#include <regex>	//regex, regex_match
-#include <stack>
-#include <unordered_set>
-#include <unordered_map>
-#include <iostream>	//cout
-
-//for serialization/deserialization using cereal:
-//http://uscilab.github.io/cereal/quickstart.html
-#include <sstream>
-//#include <cereal/archives/json.hpp>
-#include <cereal/archives/binary.hpp>
-#include <cereal/types/stack.hpp>
-#include <cereal/types/unordered_set.hpp>
+#include "scanner_trace.h"
+#include "scanner_limits.h"
+#include "scanner_entities.h"
+#include "html_entities.h"
+#include <atomic>	//atomic
+#include <cstdint>	//uint8_t, uint16_t, uint32_t, int32_t, uintptr_t
+#include <cstring>	//memcpy, memcmp
+#include <algorithm>	//max, min
+#include <cassert>	//assert
+
+extern "C" const TSLanguage *tree_sitter_roll20_script(void);
 
 namespace {
 
 using namespace std;
 
 
-const bool DEBUGGING = false;
 const unsigned MAX_ENTITY_NAME_LENGTH = 50;
 
 
 enum TokenType {
 	ROLLQUERY_START,
 	ROLLQUERY_END,
-		
+	
 	INLINEROLL_START,
 	INLINEROLL_END,
-		
+	
 	LABEL_START,
 	LABEL_END,
-		
+	
 	BUTTON_START,
 	BUTTON_END,
-		
+	
 	GROUPROLL_START,
 	GROUPROLL_END,
-		
+	
 	TABLEROLL_START,
 	TABLEROLL_END,
 	
@@ -56,155 +52,235 @@ enum TokenType {
 	ROLLTEMPLATE_PROPERTY_END,
 	
 	HTML_ENTITY,
-		
-	AMPERSAND,
-};
-//for debugging:
-unordered_map<int, string> symbol_strings({
-	{ ROLLQUERY_START, "ROLLQUERY_START" },
-	{ ROLLQUERY_END, "ROLLQUERY_END" },
-		
-	{ INLINEROLL_START, "INLINEROLL_START" },
-	{ INLINEROLL_END, "INLINEROLL_END" },
-		
-	{ LABEL_START, "LABEL_START" },
-	{ LABEL_END, "LABEL_END" },
-		
-	{ BUTTON_START, "BUTTON_START" },
-	{ BUTTON_END, "BUTTON_END" },
-		
-	{ GROUPROLL_START, "GROUPROLL_START" },
-	{ GROUPROLL_END, "GROUPROLL_END" },
-		
-	{ TABLEROLL_START, "TABLEROLL_START" },
-	{ TABLEROLL_END, "TABLEROLL_END" },
 	
-	{ PIPE, "PIPE" },
-	{ COMMA, "COMMA" },
-	{ LEFT_BRACE, "LEFT_BRACE" },
-	{ RIGHT_BRACE, "RIGHT_BRACE" },
-	{ LEFT_PAREN, "LEFT_PAREN" },
-	{ RIGHT_PAREN, "RIGHT_PAREN" },
-	{ COLON, "COLON" },
+	AMPERSAND,
 	
-	{ FLAG_START, "FLAG_START" },
-	{ FLAG_END, "FLAG_END" },
-	{ ROLLTEMPLATE_PROPERTY_START, "ROLLTEMPLATE_PROPERTY_START" },
-	{ ROLLTEMPLATE_PROPERTY_END, "ROLLTEMPLATE_PROPERTY_END" },
+	TEXT,
 	
-	{ HTML_ENTITY, "HTML_ENTITY" },
-		
-	{ AMPERSAND, "AMPERSAND" },
-});
-
-
-struct HtmlEntity;
+	DEFAULT_PIPE,
+};
+const unsigned SYMBOL_COUNT = DEFAULT_PIPE + 1;
+const uint32_t ALL_SYMBOLS = ~uint32_t(0) >> (32 - SYMBOL_COUNT);
 
 
 /*╔════════════════════════════════════════════════════════════
-  ║ For debugging
-  ╚════════════════════════════════════════════════════════════*/
+  ║ Tracing
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ The scanner reports what it does to a trace policy (see scanner_trace.h).
+   │ NoTrace does nothing, so every call to it compiles away. RingBufferTrace
+   │ records one compact event per scan that gets past the lookahead check.
+   │ 
+   │ The events go into a ring buffer per thread rather than per scanner, so
+   │ that nothing refers to a scanner once it's destroyed (a parser can be
+   │ deleted on a different thread from the one that last used it).
+   └─────────────────────────────*/
 
-enum ANSI_Color {
-	noChange=0,
-	
-	//https://stackoverflow.com/a/45300654/15788
-	default=39,
-	
-	black=30,
-	darkGray=90,gray=90,dimGray=90,
-	lightGray=37,brightGray=37,
-	white=97,
-	
-	red=31,dimRed=31,darkRed=31,
-	yellow=33,dimYellow=33,darkYellow=33,
-	green=32,dimGreen=32,darkGreen=32,
-	cyan=36,dimCyan=36,darkCyan=36,
-	blue=34,dimBlue=34,darkBlue=34,
-	magenta=35,dimMagenta=35,darkMagenta=35,
-	
-	brightRed=91,lightRed=91,
-	brightYellow=93,lightYellow=93,
-	brightGreen=92,lightGreen=92,
-	brightCyan=96,lightCyan=96,
-	brightBlue=94,lightBlue=94,
-	brightMagenta=95,lightMagenta=95,
+struct NoTrace {
+	void begin() {}
+	void advanced() {}
+	void markedEnd() {}
+	void decodedEntity(unsigned) {}
+	void end(int, unsigned) {}
 };
-string color(ANSI_Color foreground = noChange, ANSI_Color background = noChange) {
-	return "\033["
-		+(foreground?to_string(foreground):"")
-		+((foreground&&background)?";":"")
-		+(background?to_string(background+10):"")
-		+"m";
-}
-string color_passFail(bool test) { return color(test ? brightGreen : darkRed); }
 
-struct DebugTools {
-	
-private:
-	string consumed = "";
-	unsigned markedEndAt = 0;
+#ifdef ROLL20_SCRIPT_SCANNER_TRACE
+
+//the most recent scans on this thread, by any scanner
+struct TraceEvents {
+	Roll20ScriptTraceEvent events[ROLL20_SCRIPT_TRACE_CAPACITY];
+	uint32_t scans;		//total number of events recorded
 	
-public:
-	void init() {
-		consumed = "";
-		markedEndAt = 0;
+	//copy up to `count` of the most recent events, oldest first
+	size_t copy(Roll20ScriptTraceEvent *out, size_t count) const {
+		size_t available = min<size_t>(scans, ROLL20_SCRIPT_TRACE_CAPACITY);
+		if (count > available) count = available;
+		for (size_t i=0; i<count; i++) {
+			out[i] = events[(scans - count + i) % ROLL20_SCRIPT_TRACE_CAPACITY];
+		}
+		return count;
 	}
+};
+thread_local TraceEvents traceEvents = {};
+
+struct RingBufferTrace {
+
+	Roll20ScriptTraceEvent current;
+	uint16_t advances = 0;
 	
-	
-	void log(string str) {
-		if (!DEBUGGING) return;
-		cout << "\033[0m" << str << "\033[0m" << endl;
+	void begin() {
+		current = Roll20ScriptTraceEvent();
+		current.scan = traceEvents.scans;
+		advances = 0;
+	}
+	void advanced() { if (advances < UINT16_MAX) advances++; }
+	void markedEnd() { current.length = advances; }
+	void decodedEntity(unsigned timesDecoded) { current.times_decoded = uint8_t(min(timesDecoded, 255u)); }
+	void end(int symbol, unsigned depth) {
+		if (symbol < 0) current.length = advances;
+		current.symbol = symbol < 0 ? ROLL20_SCRIPT_TRACE_NO_MATCH : uint8_t(symbol);
+		current.depth = uint8_t(min(depth, 255u));
+		traceEvents.events[traceEvents.scans++ % ROLL20_SCRIPT_TRACE_CAPACITY] = current;
 	}
+
+};
+
+typedef RingBufferTrace Trace;
+
+#else
+typedef NoTrace Trace;
+#endif
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ HTML Entity Names
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Recognize the names/codes of HTML entities, and the characters they
+   │ represent, without building a regular expression.
+   │ 
+   │ A name is only an entity if it's one of the HTML5 named character
+   │ references (see html_entities.h).
+   │ 
+   │ A numeric code is only recognized as a character the scanner cares about
+   │ in these forms (e.g., for '{'):
+   │ • decimal, without leading zeros: #123
+   │ • hexadecimal, with two digits or four digits starting with "00": #x7b, #X007B
+   └─────────────────────────────*/
+
+constexpr bool isDigit(int32_t c) { return c >= '0' && c <= '9'; }
+constexpr bool isAlphanumeric(int32_t c) { return isDigit(c) || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+constexpr int hexValue(int32_t c) {
+	return isDigit(c) ? c - '0'
+		: (c >= 'a' && c <= 'f') ? c - 'a' + 10
+		: (c >= 'A' && c <= 'F') ? c - 'A' + 10
+		: -1;
+}
+
+//an entity name/code (without the '&' and ';'), stored inline
+struct EntityName {
+	char chars[MAX_ENTITY_NAME_LENGTH];
+	unsigned length = 0;
 	
+	bool empty() const { return length == 0; }
+	char operator[](unsigned i) const { return chars[i]; }
 	
-	void logValidSymbols(const bool *valid_symbols) {
-		if (!DEBUGGING) return;
-		string str = color(darkGray);
-		for (auto it = symbol_strings.begin(); it != symbol_strings.end(); ++it) {
-			str += (valid_symbols[it->first] ? it->second+", " : "");
-		}
-		log(str);
+	bool append(int32_t c) {
+		if (length >= MAX_ENTITY_NAME_LENGTH) return false;
+		chars[length++] = char(c);
+		return true;
 	}
+};
+
+//the code point represented by an HTML5 entity name, or -1 if there's no such entity
+int32_t lookupNamedEntity(const EntityName &name) {
+	if (name.length > HTML_ENTITY_MAX_NAME_LENGTH) return -1;
 	
-	
-	void saveLookahead(TSLexer *lexer) {
-		if (!DEBUGGING) return;
-		consumed += lexer->lookahead;
+	unsigned low = 0, high = HTML_ENTITY_COUNT;
+	while (low < high) {
+		unsigned mid = (low + high) / 2;
+		const HtmlEntityEntry &entry = HTML_ENTITIES[mid];
+		
+		int order = memcmp(&HTML_ENTITY_NAMES[entry.offset], name.chars, min<unsigned>(entry.length, name.length));
+		if (order == 0) order = int(entry.length) - int(name.length);
+		
+		if (order == 0) return int32_t(entry.codePoint);
+		if (order < 0) low = mid + 1;
+		else high = mid;
 	}
-	void logLookahead(TSLexer *lexer) {
-		if (!DEBUGGING) return;
-		log(color(darkCyan)+"  Lookahead '"+color(lightCyan)+string({char(lexer->lookahead)})+color(darkCyan)+"'");
+	return -1;
+}
+
+//the character represented by a numeric code, or 0 if it's not one the scanner recognizes
+char decodeNumericEntity(const EntityName &name) {
+	unsigned code = 0;
+	if (name[1] == 'x' || name[1] == 'X') {
+		unsigned i = (name.length == 6 && name[2] == '0' && name[3] == '0') ? 4 : 2;
+		if (name.length - i != 2) return 0;
+		for (; i<name.length; i++) code = code*16 + hexValue(name[i]);
 	}
-	void logMarkEnd(TSLexer *lexer) {
-		if (!DEBUGGING) return;
-		log(color(yellow)+"Mark end before '"+string({char(lexer->lookahead)})+"'");
-		markedEndAt = consumed.length();
+	else {
+		if (name.length > 4 || name[1] == '0') return 0;
+		for (unsigned i=1; i<name.length; i++) code = code*10 + (name[i] - '0');
 	}
+	return code < 0x80 ? char(code) : 0;
+}
+
+//Determine whether the string is a known entity name or a well-formed numeric code. If it is,
+// `character` is set to the character it represents, or 0 if that's not one the scanner recognizes.
+bool resolveEntityName(const EntityName &name, char &character) {
+	character = 0;
+	if (name.length == 0) return false;
 	
+	if (name[0] != '#') {
+		int32_t codePoint = lookupNamedEntity(name);
+		if (codePoint < 0) return false;
+		if (codePoint < 0x80) character = char(codePoint);
+		return true;
+	}
 	
-	void logMatchFound(TSLexer *lexer, int symbol) {
-		if (!DEBUGGING) return;
-		log(color(yellow)+"Result set to "+color(brightYellow)+symbol_strings[symbol]);
-		log("  "
-			+color(brightYellow)+consumed.substr(0, markedEndAt)
-			+color(gray)+consumed.substr(markedEndAt)
-			+color(cyan)+string({char(lexer->lookahead)})
-		);
+	if (name.length > 2 && (name[1] == 'x' || name[1] == 'X')) {
+		for (unsigned i=2; i<name.length; i++) if (hexValue(name[i]) < 0) return false;
 	}
-	void logNoMatch(TSLexer *lexer) {
-		if (!DEBUGGING) return;
-		log(color(yellow)+"Result set to "+color(brightYellow)+"(no match)");
-		unsigned consumed_length = max(int(markedEndAt), int(consumed.length()-1));
-		log("  "
-			+color(gray)+consumed.substr(0, consumed_length)
-			+color(cyan)+consumed.substr(consumed_length)
-			+color(cyan)+string({char(lexer->lookahead)})
-		);
+	else {
+		if (name.length < 2) return false;
+		for (unsigned i=1; i<name.length; i++) if (!isDigit(name[i])) return false;
 	}
 	
-};
-DebugTools Debug;
+	character = decodeNumericEntity(name);
+	return true;
+}
+
+//Writes the UTF-8 encoding of a code point, and returns the number of bytes written.
+unsigned encodeUtf8(uint32_t codePoint, char *out) {
+	if (codePoint < 0x80) {
+		out[0] = char(codePoint);
+		return 1;
+	}
+	if (codePoint < 0x800) {
+		out[0] = char(0xC0 | codePoint >> 6);
+		out[1] = char(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	if (codePoint < 0x10000) {
+		out[0] = char(0xE0 | codePoint >> 12);
+		out[1] = char(0x80 | (codePoint >> 6 & 0x3F));
+		out[2] = char(0x80 | (codePoint & 0x3F));
+		return 3;
+	}
+	out[0] = char(0xF0 | codePoint >> 18);
+	out[1] = char(0x80 | (codePoint >> 12 & 0x3F));
+	out[2] = char(0x80 | (codePoint >> 6 & 0x3F));
+	out[3] = char(0x80 | (codePoint & 0x3F));
+	return 4;
+}
+
+//see scanner_entities.h
+size_t decodeEntities(const char *text, size_t length, char *decoded) {
+	size_t size = 0;
+	size_t i = 0;
+	while (i < length) {
+		if (text[i] != '&') {
+			decoded[size++] = text[i++];
+			continue;
+		}
+		
+		//(the name is read the way getNextEntityName reads it)
+		EntityName name;
+		size_t end = i + 1;
+		while (end < length && (text[end] == '#' || isAlphanumeric(text[end])) && name.append(text[end])) end++;
+		
+		char character;
+		if (end < length && text[end] == ';' && resolveEntityName(name, character)) {
+			int32_t codePoint = name[0] == '#' ? character : lookupNamedEntity(name);
+			if (codePoint > 0) {
+				size += encodeUtf8(uint32_t(codePoint), decoded + size);
+				i = end + 1;
+				continue;
+			}
+		}
+		decoded[size++] = text[i++];
+	}
+	return size;
+}
 
 
 /*╔════════════════════════════════════════════════════════════
@@ -212,88 +288,351 @@ DebugTools Debug;
   ╚╤═══════════════════════════════════════════════════════════*/
  /*│ Track the state of nested roll queries, group rolls, table rolls, and buttons.
    │ This includes their depth and related special characters.
+   │ 
+   │ Only a handful of characters are ever unsafe ("|,}]):"), so each level is
+   │ stored as a bitmask of them. A level includes the unsafe characters of
+   │ the levels below it.
+   │ 
+   │ The stack has a fixed capacity; elements nested deeper than that are
+   │ not tracked.
    └─────────────────────────────*/
 
+//the bit representing a character that can be unsafe, or 0 if it's never unsafe
+constexpr uint8_t unsafeCharBit(const int32_t c) {
+	return c == '|' ? 1<<0
+		: c == ',' ? 1<<1
+		: c == '}' ? 1<<2
+		: c == ']' ? 1<<3
+		: c == ')' ? 1<<4
+		: c == ':' ? 1<<5
+		: 0;
+}
+constexpr uint8_t unsafeCharBits(const char *chars) {
+	return *chars ? unsafeCharBit(*chars) | unsafeCharBits(chars+1) : 0;
+}
+
 struct NestedElements {
+
+	static const unsigned MAX_DEPTH = 255;
 	
-	stack<unordered_set<char>> unsafeChars;
+	uint8_t unsafeChars[MAX_DEPTH];
+	unsigned levels = 0;
 	
-	unsigned depth(){ return unsafeChars.size(); }
+	unsigned depth(){ return levels; }
 	
-	unsigned push(const string specialChars){
-		unordered_set<char> uc;
-		if (unsafeChars.size() > 0) uc = unsafeChars.top();
-		unsigned i;
-		for (i=0; i<specialChars.length(); i++) {
-			uc.insert(specialChars[i]);
+	unsigned push(const char *specialChars){
+		if (levels < MAX_DEPTH) {
+			unsafeChars[levels] = (levels > 0 ? unsafeChars[levels-1] : 0) | unsafeCharBits(specialChars);
+			levels++;
 		}
-		unsafeChars.push(uc);
 		return this->depth();
 	}
 	
 	unsigned pop(){
-		if (unsafeChars.size() > 0) unsafeChars.pop();
+		if (levels > 0) levels--;
 		return this->depth();
 	}
 	
-	bool isUnsafe(const char c){
-		if (unsafeChars.size() <= 1) return false;
-		return unsafeChars.top().count(c) > 0;
+	bool isUnsafe(const int32_t c){
+		if (levels <= 1) return false;
+		return (unsafeChars[levels-1] & unsafeCharBit(c)) != 0;
 	}
 	
-	bool isSafe(const char c){ return !isUnsafe(c); }
+	bool isSafe(const int32_t c){ return !isUnsafe(c); }
+	
+	//whether the character is one of the innermost element's own delimiters (a colon only
+	// delimits a flag's name)
+	bool isDelimiter(const int32_t c){
+		if (levels == 0) return false;
+		return (unsafeChars[levels-1] & unsafeCharBit(c) & ~unsafeCharBit(':')) != 0;
+	}
 	
 	
 	
-	template<class Archive>
-	void serialize(Archive & archive) {
-		archive(unsafeChars);
+	//copy the bitmask of each level into the buffer; returns the number of bytes written
+	unsigned serialize(char *buffer){
+		memcpy(buffer, unsafeChars, levels);
+		return levels;
 	}
+	void deserialize(const char *buffer, unsigned depth){
+		levels = depth <= MAX_DEPTH ? depth : 0;
+		memcpy(unsafeChars, buffer, levels);
+	}
+
+};
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Lookahead Classification
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ For each byte, the set of symbols that can start with it. If none of
+   │ them are valid, the scanner can reject the character without doing
+   │ anything else.
+   │ 
+   │ An ampersand can start any symbol, since it might be the beginning of an
+   │ HTML entity. Text can start with anything except an ampersand, a hash, or
+   │ an opening square bracket (and code points above 0xFF can only start
+   │ text).
+   └─────────────────────────────*/
+
+constexpr uint32_t symbolBit(TokenType symbol) { return uint32_t(1) << symbol; }
+
+//symbols that start a level of `nest`
+constexpr uint32_t NESTING_SYMBOLS = symbolBit(ROLLQUERY_START) | symbolBit(LABEL_START) | symbolBit(BUTTON_START)
+	| symbolBit(GROUPROLL_START) | symbolBit(TABLEROLL_START) | symbolBit(FLAG_START);
+
+constexpr bool canStartText(int32_t c) { return c != 0 && c != '&' && c != '#' && c != '['; }
+
+constexpr uint32_t delimitersStartingWith(int c) {
+	return c == '?' ? symbolBit(ROLLQUERY_START)
+		: c == '[' ? symbolBit(INLINEROLL_START) | symbolBit(LABEL_START)
+		: c == '(' ? symbolBit(BUTTON_START) | symbolBit(LEFT_PAREN)
+		: c == '{' ? symbolBit(ROLLTEMPLATE_PROPERTY_START) | symbolBit(GROUPROLL_START) | symbolBit(LEFT_BRACE)
+		: (c == 't' || c == 'T') ? symbolBit(TABLEROLL_START)
+		: c == '}' ? symbolBit(ROLLQUERY_END) | symbolBit(GROUPROLL_END) | symbolBit(FLAG_END)
+			| symbolBit(ROLLTEMPLATE_PROPERTY_END) | symbolBit(RIGHT_BRACE)
+		: c == ']' ? symbolBit(INLINEROLL_END) | symbolBit(LABEL_END) | symbolBit(TABLEROLL_END)
+		: c == ')' ? symbolBit(BUTTON_END) | symbolBit(RIGHT_PAREN)
+		: c == '|' ? symbolBit(PIPE) | symbolBit(DEFAULT_PIPE)
+		: c == ',' ? symbolBit(COMMA)
+		: c == ':' ? symbolBit(COLON)
+		: 0;
+}
+
+constexpr uint32_t symbolsStartingWith(int c) {
+	return c == '&' ? ALL_SYMBOLS
+		: delimitersStartingWith(c) | (canStartText(c) ? symbolBit(TEXT) : 0);
+}
+
+struct LookaheadTable {
+	uint32_t symbols[256];
 	
+	constexpr LookaheadTable() : symbols() {
+		for (int c=0; c<256; c++) symbols[c] = symbolsStartingWith(c);
+	}
 };
+constexpr LookaheadTable LOOKAHEAD_TABLE;
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Valid Symbols
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Tree-sitter always passes a pointer to one of the rows of the parser's
+   │ (read-only) table of external lex states, and there are only a few dozen
+   │ of those. Each row is converted into a bitmask the first time it's seen
+   │ and cached by its address, so testing whether a symbol is valid is a
+   │ single bit test instead of a memory load.
+   │ 
+   │ The rows are contiguous and each has one entry per external token in
+   │ the generated parser, so a direct-mapped cache indexed by row number
+   │ holds all of them without collisions, as long as there are no more
+   │ than SIZE rows (the generated parser has 58). A debug build stops if a
+   │ row ever evicts another.
+   │ 
+   │ That's the same number as SYMBOL_COUNT unless src/parser.c is out of
+   │ date with grammar.js (run `tree-sitter generate`). A debug build stops
+   │ on that. Otherwise, nothing past the end of a row is read, and symbols
+   │ the parser doesn't have are never valid, since it couldn't map them.
+   └─────────────────────────────*/
+
+struct ValidSymbolsCache {
+
+	static const unsigned SIZE = 64;
+	
+	const unsigned stride;
+	const unsigned symbolCount;
+	const uint32_t all;		//every symbol is valid (i.e., the parser is recovering from an error)
+	
+	const bool *rows[SIZE] = {};
+	uint32_t masks[SIZE];
+	
+	explicit ValidSymbolsCache(unsigned externalTokenCount)
+		: stride(externalTokenCount), symbolCount(min(externalTokenCount, SYMBOL_COUNT)),
+		  all(ALL_SYMBOLS >> (SYMBOL_COUNT - symbolCount))
+	{
+		assert(externalTokenCount == SYMBOL_COUNT && "src/parser.c is out of date with the scanner's externals");
+	}
+	
+	uint32_t convert(const bool *row) const {
+		uint32_t mask = 0;
+		for (unsigned symbol=0; symbol<symbolCount; symbol++) {
+			if (row[symbol]) mask |= uint32_t(1) << symbol;
+		}
+		return mask;
+	}
+	
+	uint32_t get(const bool *row) {
+		unsigned i = (uintptr_t(row) / stride) % SIZE;
+		if (rows[i] != row) {
+			assert(rows[i] == nullptr && "the parser has more external lex states than the cache has entries");
+			rows[i] = row;
+			masks[i] = convert(row);
+		}
+		return masks[i];
+	}
+
+};
+
+/*┌──────────────────────────────
+  │ The scanner takes the valid symbols of each scan through one of these.
+  │ CachedValidSymbols is the bitmask from the cache. RowValidSymbols reads
+  │ the parser's row an entry at a time, the way the scanner did before the
+  │ rows were cached; it's only there to compare against (see
+  │ test/valid_symbols_bench.cc).
+  └┬─────────────────────────────*/
+
+struct CachedValidSymbols {
+	explicit CachedValidSymbols(const TSLanguage *language) : cache(language->external_token_count) {}
+	
+	ValidSymbolsCache cache;
+	uint32_t mask = 0;
+	bool recovering = false;
+	
+	void load(const bool *row) {
+		mask = cache.get(row);
+		recovering = mask == cache.all;
+	}
+	bool has(TokenType symbol) const { return (mask & symbolBit(symbol)) != 0; }
+	uint32_t among(uint32_t symbols) const { return mask & symbols; }
+	void remove(uint32_t symbols) { mask &= ~symbols; }
+};
+
+struct RowValidSymbols {
+	explicit RowValidSymbols(const TSLanguage *language)
+		: count(min(language->external_token_count, unsigned(SYMBOL_COUNT))) {}
+	
+	const unsigned count;
+	const bool *row = nullptr;
+	uint32_t removed = 0;
+	bool recovering = false;
+	
+	void load(const bool *theRow) {
+		row = theRow;
+		removed = 0;
+		recovering = true;
+		for (unsigned symbol=0; symbol<count && recovering; symbol++) recovering = row[symbol];
+	}
+	bool has(TokenType symbol) const {
+		return unsigned(symbol) < count && row[symbol] && (removed & symbolBit(symbol)) == 0;
+	}
+	//one entry of the row for each of `symbols`
+	uint32_t among(uint32_t symbols) const {
+		uint32_t valid = 0;
+		for (uint32_t rest = symbols & ~removed; rest != 0; rest &= rest - 1) {
+			uint32_t bit = rest & (0 - rest);
+			unsigned symbol = BIT_INDEX[uint32_t(bit * 0x077CB531u) >> 27];
+			if (symbol < count && row[symbol]) valid |= bit;
+		}
+		return valid;
+	}
+	void remove(uint32_t symbols) { removed |= symbols; }
+	
+	//the index of a single bit, by its de Bruijn product
+	static constexpr uint8_t BIT_INDEX[32] = {
+		0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+		31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9
+	};
+};
+constexpr uint8_t RowValidSymbols::BIT_INDEX[32];
+
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Limits
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ The settings made through scanner_limits.h. Each scanner copies them
+   │ when it's created.
+   │ 
+   │ Which limits were reached is per thread rather than per scanner, since
+   │ the embedding application has the parser but not the scanner.
+   └─────────────────────────────*/
+
+struct Limits {
+	unsigned recoveryBudget;
+	unsigned maxDepth;
+	unsigned maxEntityChain;
+};
+
+struct LimitSettings {
+	atomic<uint16_t> recoveryBudget{ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET};
+	atomic<uint8_t> maxDepth{ROLL20_SCRIPT_DEFAULT_MAX_DEPTH};
+	atomic<uint8_t> maxEntityChain{ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN};
+	
+	Limits get() const {
+		Limits limits;
+		limits.recoveryBudget = recoveryBudget.load(memory_order_relaxed);
+		limits.maxDepth = maxDepth.load(memory_order_relaxed);
+		limits.maxEntityChain = maxEntityChain.load(memory_order_relaxed);
+		return limits;
+	}
+};
+LimitSettings limitSettings;
+
+thread_local unsigned limitsReached = 0;
 
 
 /*╔════════════════════════════════════════════════════════════
   ║ The Scanner
   ╚════════════════════════════════════════════════════════════*/
 
-struct Scanner {
-	Scanner() {}
+template <typename ValidSymbols>
+struct BasicScanner {
+	BasicScanner() : validSymbols(tree_sitter_roll20_script()), limits(limitSettings.get()) {}
 	
 	TSLexer *lexer;
-	const bool *valid_symbols;
+	ValidSymbols validSymbols;
+	
+	const Limits limits;
 	
 	NestedElements nest;
 	bool inRollTemplateProperty = false;
+	unsigned recoveryScans = 0;		//tokens matched since the parser started recovering from the current error
+	
+	Trace trace;
 	
 	
 	/*╔════════════════════════════════════════════════════════════
-	  ║ Serialize/deserialize the state of `nest`
-	  ╚════════════════════════════════════════════════════════════*/
+	  ║ Serialize/deserialize the state of the scanner
+	  ╚╤═══════════════════════════════════════════════════════════*/
+	 /*│ Layout of the buffer:
+	   │ [0]     number of levels in `nest`
+	   │ [1]     flags (bit 0: `inRollTemplateProperty`)
+	   │ [2,3]   `recoveryScans` (little-endian)
+	   │ [4...]  bitmask of unsafe characters for each level of `nest`, from the bottom up
+	   │ 
+	   │ The initial state is serialized as zero bytes.
+	   │ 
+	   │ This is everything a scan depends on (the rest of the scanner is
+	   │ settings and caches). After an edit, tree-sitter restores the state
+	   │ from before a reused token and resumes scanning from there, so a
+	   │ restored scanner has to behave exactly like the one that saved it.
+	   └─────────────────────────────*/
+	
+	static const unsigned SERIALIZED_HEADER_SIZE = 4;
+	static_assert(SERIALIZED_HEADER_SIZE + NestedElements::MAX_DEPTH <= TREE_SITTER_SERIALIZATION_BUFFER_SIZE,
+		"the serialized state of the scanner must fit in tree-sitter's buffer");
 	
 	unsigned serialize(char * buffer) {
-		stringstream stream_out;
-		{
-			//cereal::JSONOutputArchive archive_out(stream_out);
-			cereal::BinaryOutputArchive archive_out(stream_out);
-			archive_out(nest);
-		}
-		string state2save = stream_out.str();
-		state2save.copy(&buffer[0], state2save.size());
-		return state2save.size()+1;
+		if (nest.depth() == 0 && !inRollTemplateProperty && recoveryScans == 0) return 0;
+		
+		buffer[0] = char(nest.depth());
+		buffer[1] = char(inRollTemplateProperty ? 1 : 0);
+		buffer[2] = char(recoveryScans & 0xFF);
+		buffer[3] = char(recoveryScans >> 8);
+		return SERIALIZED_HEADER_SIZE + nest.serialize(&buffer[SERIALIZED_HEADER_SIZE]);
 	}
 	void deserialize(const char * buffer, unsigned length) {
-		if (length > 0) {
-			string state2load;
-			state2load.assign(&buffer[0], length);
-			stringstream stream_in;
-			stream_in.str(state2load);
-			{
-				//cereal::JSONInputArchive archive_in(stream_in);
-				cereal::BinaryInputArchive archive_in(stream_in);
-				archive_in(nest);
-			}
-		}
+		nest.deserialize(buffer, 0);
+		inRollTemplateProperty = false;
+		recoveryScans = 0;
+		
+		if (length < SERIALIZED_HEADER_SIZE) return;
+		
+		unsigned depth = uint8_t(buffer[0]);
+		if (depth > length - SERIALIZED_HEADER_SIZE) return;
+		
+		inRollTemplateProperty = (buffer[1] & 1) != 0;
+		recoveryScans = uint8_t(buffer[2]) | unsigned(uint8_t(buffer[3])) << 8;
+		nest.deserialize(&buffer[SERIALIZED_HEADER_SIZE], depth);
 	}
 	
 	
@@ -302,19 +641,15 @@ struct Scanner {
 	  ╚════════════════════════════════════════════════════════════*/
 	
 	struct HtmlEntity {
-		string str = "&";			//the '&', a possible chain of "amp;" strings, the final
-									// entity name/code, and the following ';'
-		
-		string entityName = "";		//just the final name/code, not including the following ';'
-		
-		string remainder = "";		//final characters that were traversed but did not end up
-									// being part of the entity
+		EntityName entityName;		//just the final name/code, not including the following ';'
+		char character = 0;			//the character represented by `entityName`, if it's one the
+									// scanner recognizes
 		
 		unsigned timesEncoded = 0;	//number of times the represented character was encoded
-		unsigned foundAtDepth;		//the current depth when this entity was encountered
+		unsigned foundAtDepth = 0;	//the current depth when this entity was encountered
 		
-		bool isChar(unsigned depth) { return timesEncoded == depth - 1; }
-		bool isEntity(unsigned depth) { return timesEncoded >= depth; }
+		bool isChar(unsigned depth) const { return timesEncoded == depth - 1; }
+		bool isEntity(unsigned depth) const { return timesEncoded >= depth; }
 	};
 	enum UseEntityAs {
 		AS_CHARACTER,
@@ -322,33 +657,31 @@ struct Scanner {
 		AS_START,
 	};
 	
-	string getNextEntityName(TSLexer *lexer, string &remainder){
-		
-		string entityName = "";
-		char c = lexer->lookahead;
+	//(`entityName` is left empty if there isn't an entity at the lookahead)
+	void getNextEntityName(TSLexer *lexer, EntityName &entityName, char &character){
+	
+		entityName.length = 0;
+		int32_t c = lexer->lookahead;
 		
-		while (c != ';' && c != 0 && entityName.length() < MAX_ENTITY_NAME_LENGTH) {
-			if (!regex_match(string({c}), regex("[#\\da-zA-Z;]"))) break;
-			entityName += c;
+		while (c != ';' && c != 0) {
+			if (c != '#' && !isAlphanumeric(c)) break;
+			if (!entityName.append(c)) break;
 			c = advance(lexer);
 		}
 		
-		if (c == ';' && regex_match(entityName, regex("([\\da-zA-Z]+|#(\\d+|[xX][\\da-fA-F]+))"))) {
+		if (c == ';' && resolveEntityName(entityName, character)) {
 			c = advance(lexer);
-			
-			return entityName;
+			return;
 		}
 		
-		remainder = entityName;
-		return "";
-		
+		entityName.length = 0;
+		character = 0;
+	
 	}
 	
 	//(when called, lexer->lookahead should be the character after '&')
 	HtmlEntity getHtmlEntity() {
-		
-		regex rxp_amp = regex("amp|AMP|#38|#[xX](00)?26");
-		
+	
 		//if it's not a character after this many decodings, it will always be interpreted as an HTML entity
 		unsigned maxDecodings = max(0, int(nest.depth())-1);
 		
@@ -357,15 +690,24 @@ struct Scanner {
 		
 		
 		while (obj.timesEncoded <= maxDecodings) {
+		
+			if (obj.timesEncoded == limits.maxEntityChain) {
+				//the rest of the chain is plain text; the limit only counts as reached if there is a rest
+				//(the lexer moves past it, but not the end of the token)
+				EntityName nextName;
+				char nextCharacter;
+				getNextEntityName(lexer, nextName, nextCharacter);
+				if (!nextName.empty()) limitsReached |= ROLL20_SCRIPT_LIMIT_ENTITY_CHAIN;
+				break;
+			}
 			
-			obj.entityName = getNextEntityName(lexer, obj.remainder);
+			getNextEntityName(lexer, obj.entityName, obj.character);
 			
-			if (obj.entityName != "") {
+			if (!obj.entityName.empty()) {
 				mark_end(lexer);
-				obj.str += obj.entityName+";";
 				obj.timesEncoded++;
 				
-				if (!regex_match(obj.entityName, rxp_amp)) {
+				if (obj.character != '&') {
 					//it's an entity for something besides an ampersand
 					break;
 				}
@@ -376,12 +718,13 @@ struct Scanner {
 			}
 		}
 		
+		trace.decodedEntity(obj.timesEncoded);
 		return obj;
 	}
 	
 	template <int N>
-	bool checkEntity(HtmlEntity entity, const int (&symbols)[N], char encodedChar, string rxp, int useAs = AS_CHARACTER) {
-		bool entityMatches = regex_match(entity.entityName, regex(rxp));
+	bool checkEntity(const HtmlEntity &entity, const int (&symbols)[N], char encodedChar, int useAs = AS_CHARACTER) {
+		bool entityMatches = entity.character == encodedChar;
 		
 		bool validUse = ( useAs == AS_CHARACTER && entity.isChar(nest.depth() + (inRollTemplateProperty?1:0)) )
 			|| ( useAs == AS_ENTITY && entity.isEntity(nest.depth()) )
@@ -389,64 +732,63 @@ struct Scanner {
 		
 		bool validSymbolFound = false;
 		for (int i=0; i<N; i++) {
-			if (valid_symbols[symbols[i]]) {
+			if (isValid(symbols[i])) {
 				validSymbolFound = true;
 				break;
 			}
 		}
 		
-		if (DEBUGGING) {
-			string str = "" +
-				//HTML entity; does it match?
-				color_passFail(entityMatches) + entity.str + "  " +
-				//character it represents; is it safe here?
-				color_passFail(nest.isSafe(encodedChar)) + string({encodedChar}) + "  " +
-				//its intended use; can it be that?
-				color_passFail(validUse) +
-				(useAs==AS_CHARACTER ? "char  " :
-				useAs==AS_START ? "start " :
-				useAs==AS_ENTITY ? "entity" :
-				"n/a   ") +
-				color(green) + "  [ ";
-			
-			//highlight accepted symbols
-			for (int i=0; i<N; i++) {
-				if (i > 0) str += color(green)+", ";
-				str += color_passFail(valid_symbols[symbols[i]]) + symbol_strings[symbols[i]];
-			}
-			Debug.log(str + color(green) + " ]");
-		}
-		
 		return ( validSymbolFound && validUse && entityMatches );
 	}
 	
 	
+	/*╔════════════════════════════════════════════════════════════
+	  ║ Valid symbols
+	  ╚════════════════════════════════════════════════════════════*/
+	
+	bool isValid(int symbol) { return validSymbols.has(TokenType(symbol)); }
+	
+	//whether the lookahead character can start any of the valid symbols
+	bool canStartValidSymbol(int32_t lookahead) {
+		uint32_t symbols = lookahead < 0 ? 0
+			: lookahead < 256 ? LOOKAHEAD_TABLE.symbols[lookahead]
+			: symbolBit(TEXT);
+		return validSymbols.among(symbols) != 0;
+	}
+	
+	//whether a run of text can continue with the character, i.e., it can't start anything else
+	// that's valid here, and it's not a delimiter that's unsafe at the current depth or that
+	// belongs to the innermost element (whose closer isn't valid before its first item, e.g.,
+	// a flag's value or a table's name, but still can't be text)
+	bool continuesText(int32_t c) {
+		if (c >= 256) return true;
+		if (c <= 0 || c == '&' || c == '#') return false;
+		return validSymbols.among(LOOKAHEAD_TABLE.symbols[c] & ~symbolBit(TEXT)) == 0
+			&& nest.isSafe(c) && !nest.isDelimiter(c);
+	}
+	
+	
 	/*╔════════════════════════════════════════════════════════════
 	  ║ Lexer manipulation
 	  ╚════════════════════════════════════════════════════════════*/
 	
-	char advance(TSLexer *lexer) {
-		Debug.saveLookahead(lexer);
+	int32_t advance(TSLexer *lexer) {
 		lexer->advance(lexer, false);
-		Debug.logLookahead(lexer);
+		trace.advanced();
 		return lexer->lookahead;
 	}
 	void mark_end(TSLexer *lexer) {
 		lexer->mark_end(lexer);
-		Debug.logMarkEnd(lexer);
+		trace.markedEnd();
 	}
 	
 	bool match_found(int symbol) {
-		Debug.logMatchFound(lexer, symbol);
+		trace.end(symbol, nest.depth());
 		lexer->result_symbol = symbol;
 		return true;
 	}
 	bool no_match() {
-		//consume an extra character for debug log
-		Debug.saveLookahead(lexer);
-		lexer->advance(lexer, false);
-		Debug.logNoMatch(lexer);
-		
+		trace.end(-1, nest.depth());
 		return false;
 	}
 	
@@ -456,32 +798,50 @@ struct Scanner {
 	  ╚════════════════════════════════════════════════════════════*/
 	
 	bool scan(TSLexer *theLexer, const bool *theValidSymbols){
-		
+	
 		lexer = theLexer;
-		valid_symbols = theValidSymbols;
+		validSymbols.load(theValidSymbols);
+		bool recovering = validSymbols.recovering;
+		if (!recovering) recoveryScans = 0;	//past the error, so a later one gets a budget of its own
+		
+		if (nest.depth() >= limits.maxDepth && validSymbols.among(NESTING_SYMBOLS) != 0) {
+			//nothing more can be nested, so anything that would start another level is plain text
+			if (lexer->lookahead >= 0 && lexer->lookahead < 256
+			 && validSymbols.among(LOOKAHEAD_TABLE.symbols[lexer->lookahead] & NESTING_SYMBOLS) != 0)
+				limitsReached |= ROLL20_SCRIPT_LIMIT_DEPTH;
+			validSymbols.remove(NESTING_SYMBOLS);
+		}
+		
+		if (!canStartValidSymbol(lexer->lookahead)) return false;
 		
-		Debug.init();
-		Debug.log(color(brightMagenta)+"Scanning at depth "+to_string(nest.depth()));
-		Debug.logValidSymbols(valid_symbols);
-		Debug.logLookahead(lexer);
+		trace.begin();
 		
 		HtmlEntity result;
-		string entityName = "";
 		
-		char c = lexer->lookahead;
+		int32_t c = lexer->lookahead;
 		mark_end(lexer);
 		
+		if (recovering) {
+			//the parser is recovering from an error
+			if (recoveryScans >= limits.recoveryBudget) return giveUp(c);
+			recoveryScans++;
+		}
+		
+		if (isValid(TEXT) && canStartText(c) && continuesText(c)) {
+			return scanText(c);
+		}
+		
 		if (c == '&') {
 			c = advance(lexer);
 			mark_end(lexer);
 			
 			result = getHtmlEntity();
 			
-			if (result.entityName == "") {
+			if (result.entityName.empty()) {
 				if (nest.isSafe('&')) {
-					
+				
 					if (c == '{' && nest.isSafe(c)) {
-						if (valid_symbols[FLAG_START]) {
+						if (isValid(FLAG_START)) {
 							c = advance(lexer);
 							mark_end(lexer);
 							nest.push(":}");
@@ -489,36 +849,36 @@ struct Scanner {
 						}
 					}
 					else {
-						if (c == '&' && valid_symbols[FLAG_START]) {
+						if (c == '&' && isValid(FLAG_START)) {
 							c = advance(lexer);
 							
 							result = getHtmlEntity();
 							c = lexer->lookahead;
 							
-							if (checkEntity(result, {FLAG_START}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace")) {
+							if (checkEntity(result, {FLAG_START}, '{')) {
 								mark_end(lexer);
 								nest.push(":}");
 								return match_found(FLAG_START);
 							}
 						}
 						
-						if (valid_symbols[AMPERSAND])
+						if (isValid(AMPERSAND))
 							return match_found(AMPERSAND);
 					}
-					
+				
 				}
 			}
 			else {
 				c = lexer->lookahead;
 				
-				if (checkEntity(result, {ROLLQUERY_START}, '?', "#63|#[xX](00)?3[fF]|quest", AS_START)) {
+				if (checkEntity(result, {ROLLQUERY_START}, '?', AS_START)) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {ROLLQUERY_START}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace")) {
+						if (checkEntity(result, {ROLLQUERY_START}, '{')) {
 							mark_end(lexer);
 							nest.push("|,}");
 							return match_found(ROLLQUERY_START);
@@ -532,39 +892,39 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {INLINEROLL_START, LABEL_START}, '[', "#91|#[xX](00)?5[bB]|lsqb|lbrack")) {
+				else if (checkEntity(result, {INLINEROLL_START, LABEL_START}, '[')) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {INLINEROLL_START}, '[', "#91|#[xX](00)?5[bB]|lsqb|lbrack")) {
+						if (checkEntity(result, {INLINEROLL_START}, '[')) {
 							mark_end(lexer);
 							return match_found(INLINEROLL_START);
 						}
-						else if (valid_symbols[LABEL_START]) {
+						else if (isValid(LABEL_START)) {
 							//nest.push("]");
 							return match_found(LABEL_START);
 						}
 					}
-					else if (c == '[' && valid_symbols[INLINEROLL_START] && nest.isSafe(c)) {
+					else if (c == '[' && isValid(INLINEROLL_START) && nest.isSafe(c)) {
 						return match_found(INLINEROLL_START);
 					}
-					else if (valid_symbols[LABEL_START] && nest.isSafe(c)) {
+					else if (isValid(LABEL_START) && nest.isSafe(c)) {
 						//nest.push("]");
 						return match_found(LABEL_START);
 					}
 				}
 				
-				else if (checkEntity(result, {BUTTON_START}, '(', "#40|#[xX](00)?28|lpar", AS_START)) {
+				else if (checkEntity(result, {BUTTON_START}, '(', AS_START)) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {BUTTON_START}, '~', "#126|#[xX](00)?7[eE]", AS_START)) {
+						if (checkEntity(result, {BUTTON_START}, '~', AS_START)) {
 							mark_end(lexer);
 							nest.push("|)");
 							return match_found(BUTTON_START);
@@ -578,17 +938,17 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {LEFT_PAREN}, '(', "#40|#[xX](00)?28|lpar"))
+				else if (checkEntity(result, {LEFT_PAREN}, '('))
 					return match_found(LEFT_PAREN);
 				
-				else if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_START}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace", AS_START)) {
+				else if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_START}, '{', AS_START)) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_START}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace")) {
+						if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_START}, '{')) {
 							mark_end(lexer);
 							//nest.push("}");
 							inRollTemplateProperty = true;
@@ -604,23 +964,23 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {GROUPROLL_START}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace", AS_START)) {
+				else if (checkEntity(result, {GROUPROLL_START}, '{', AS_START)) {
 					nest.push(",}");
 					return match_found(GROUPROLL_START);
 				}
 				
-				else if (checkEntity(result, {LEFT_BRACE}, '{', "#123|#[xX](00)?7[bB]|lcub|lbrace"))
+				else if (checkEntity(result, {LEFT_BRACE}, '{'))
 					return match_found(LEFT_BRACE);
 				
-				else if (checkEntity(result, {TABLEROLL_START}, 't', "#116|#[xX](00)?74", AS_START)
-				 || checkEntity(result, {TABLEROLL_START}, 'T', "#84|#[xX](00)?54", AS_START)) {
+				else if (checkEntity(result, {TABLEROLL_START}, 't', AS_START)
+				 || checkEntity(result, {TABLEROLL_START}, 'T', AS_START)) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {TABLEROLL_START}, '[', "#91|#[xX](00)?5[bB]|lsqb|lbrack", AS_START)) {
+						if (checkEntity(result, {TABLEROLL_START}, '[', AS_START)) {
 							mark_end(lexer);
 							nest.push("]");
 							return match_found(TABLEROLL_START);
@@ -634,21 +994,21 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {ROLLQUERY_END, GROUPROLL_END, FLAG_END}, '}', "#125|#[xX](00)?7[dD]|rcub|rbrace")) {
+				else if (checkEntity(result, {ROLLQUERY_END, GROUPROLL_END, FLAG_END}, '}')) {
 					nest.pop();
-					if (valid_symbols[ROLLQUERY_END]) return match_found(ROLLQUERY_END);
-					if (valid_symbols[GROUPROLL_END]) return match_found(GROUPROLL_END);
-					if (valid_symbols[FLAG_END]) return match_found(FLAG_END);
+					if (isValid(ROLLQUERY_END)) return match_found(ROLLQUERY_END);
+					if (isValid(GROUPROLL_END)) return match_found(GROUPROLL_END);
+					if (isValid(FLAG_END)) return match_found(FLAG_END);
 				}
 				
-				else if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_END}, '}', "#125|#[xX](00)?7[dD]|rcub|rbrace")) {
+				else if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_END}, '}')) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_END}, '}', "#125|#[xX](00)?7[dD]|rcub|rbrace")) {
+						if (checkEntity(result, {ROLLTEMPLATE_PROPERTY_END}, '}')) {
 							mark_end(lexer);
 							//nest.pop();
 							inRollTemplateProperty = false;
@@ -664,26 +1024,26 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {RIGHT_BRACE}, '}', "#125|#[xX](00)?7[dD]|rcub|rbrace"))
+				else if (checkEntity(result, {RIGHT_BRACE}, '}'))
 					return match_found(RIGHT_BRACE);
 				
-				else if (checkEntity(result, {INLINEROLL_END, LABEL_END, TABLEROLL_END}, ']', "#93|#[xX](00)?5[dD]|rsqb|rbrack")) {
-					if (valid_symbols[LABEL_END]) {
+				else if (checkEntity(result, {INLINEROLL_END, LABEL_END, TABLEROLL_END}, ']')) {
+					if (isValid(LABEL_END)) {
 						//nest.pop();
 						return match_found(LABEL_END);
 					}
-					else if (valid_symbols[TABLEROLL_END]) {
+					else if (isValid(TABLEROLL_END)) {
 						nest.pop();
 						return match_found(TABLEROLL_END);
 					}
-					else if (valid_symbols[INLINEROLL_END]) {
+					else if (isValid(INLINEROLL_END)) {
 						if (c == '&') {
 							c = advance(lexer);
 							
 							result = getHtmlEntity();
 							c = lexer->lookahead;
 							
-							if (checkEntity(result, {INLINEROLL_END}, ']', "#93|#[xX](00)?5[dD]|rsqb|rbrack")) {
+							if (checkEntity(result, {INLINEROLL_END}, ']')) {
 								mark_end(lexer);
 								nest.pop();
 								return match_found(INLINEROLL_END);
@@ -696,32 +1056,32 @@ struct Scanner {
 					}
 				}
 				
-				else if (checkEntity(result, {BUTTON_END}, ')', "#41|#[xX](00)?29|rpar")) {
+				else if (checkEntity(result, {BUTTON_END}, ')')) {
 					nest.pop();
 					return match_found(BUTTON_END);
 				}
 				
-				else if (checkEntity(result, {RIGHT_PAREN}, ')', "#41|#[xX](00)?29|rpar"))
+				else if (checkEntity(result, {RIGHT_PAREN}, ')'))
 					return match_found(RIGHT_PAREN);
 				
-				else if (checkEntity(result, {PIPE}, '|', "#124|#[xX](00)?7[cC]|vert|verbar|VerticalLine"))
-					return match_found(PIPE);
+				else if (checkEntity(result, {PIPE, DEFAULT_PIPE}, '|'))
+					return match_found(pipeType(lexer->lookahead));
 				
-				else if (checkEntity(result, {COMMA}, ',', "#44|#[xX](00)?2[cC]|comma"))
+				else if (checkEntity(result, {COMMA}, ','))
 					return match_found(COMMA);
 				
-				else if (checkEntity(result, {COLON}, ':', "#58|#[xX](00)?3[aA]|colon"))
+				else if (checkEntity(result, {COLON}, ':'))
 					return match_found(COLON);
 				
 				
-				if (valid_symbols[HTML_ENTITY]) {
+				if (isValid(HTML_ENTITY)) {
 					return match_found(HTML_ENTITY);
 				}
 			}
 		}
 		
 		else if (nest.isSafe(c)) {
-			if (c == '?' && valid_symbols[ROLLQUERY_START]) {
+			if (c == '?' && isValid(ROLLQUERY_START)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				
@@ -731,7 +1091,7 @@ struct Scanner {
 					result = getHtmlEntity();
 					c = lexer->lookahead;
 					
-					if (regex_match(result.entityName, regex("#123|#[xX](00)?7[bB]|lcub|lbrace"))) {
+					if (result.character == '{') {
 						mark_end(lexer);
 						nest.push("|,}");
 						return match_found(ROLLQUERY_START);
@@ -744,7 +1104,7 @@ struct Scanner {
 					return match_found(ROLLQUERY_START);
 				}
 			}
-			else if (c == '[' && (valid_symbols[INLINEROLL_START] || valid_symbols[LABEL_START])) {
+			else if (c == '[' && (isValid(INLINEROLL_START) || isValid(LABEL_START))) {
 				c = advance(lexer);
 				mark_end(lexer);
 				
@@ -754,27 +1114,27 @@ struct Scanner {
 					result = getHtmlEntity();
 					c = lexer->lookahead;
 					
-					if (regex_match(result.entityName, regex("#91|#[xX](00)?5[bB]|lsqb|lbrack"))) {
-						if (valid_symbols[INLINEROLL_START]) {
+					if (result.character == '[') {
+						if (isValid(INLINEROLL_START)) {
 							return match_found(INLINEROLL_START);
 						}
 					}
-					else if (valid_symbols[LABEL_START]) {
+					else if (isValid(LABEL_START)) {
 						nest.push("]");
 						return match_found(LABEL_START);
 					}
 				}
-				else if (c == '[' && valid_symbols[INLINEROLL_START] && nest.isSafe(c)) {
+				else if (c == '[' && isValid(INLINEROLL_START) && nest.isSafe(c)) {
 					c = advance(lexer);
 					mark_end(lexer);
 					return match_found(INLINEROLL_START);
 				}
-				else if (c != '[' && valid_symbols[LABEL_START]) {
+				else if (c != '[' && isValid(LABEL_START)) {
 					//nest.push("]");
 					return match_found(LABEL_START);
 				}
 			}
-			else if (c == '(' && valid_symbols[BUTTON_START]) {
+			else if (c == '(' && isValid(BUTTON_START)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				
@@ -784,7 +1144,7 @@ struct Scanner {
 					result = getHtmlEntity();
 					c = lexer->lookahead;
 					
-					if (regex_match(result.entityName, regex("#126|#[xX](00)?7[eE]"))) {
+					if (result.character == '~') {
 						mark_end(lexer);
 						nest.push("|)");
 						return match_found(BUTTON_START);
@@ -797,7 +1157,7 @@ struct Scanner {
 					return match_found(BUTTON_START);
 				}
 			}
-			else if (c == '(' && valid_symbols[LEFT_PAREN]) {
+			else if (c == '(' && isValid(LEFT_PAREN)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				return match_found(LEFT_PAREN);
@@ -806,14 +1166,14 @@ struct Scanner {
 				c = advance(lexer);
 				mark_end(lexer);
 				
-				if (valid_symbols[ROLLTEMPLATE_PROPERTY_START]) {
+				if (isValid(ROLLTEMPLATE_PROPERTY_START)) {
 					if (c == '&') {
 						c = advance(lexer);
 						
 						result = getHtmlEntity();
 						c = lexer->lookahead;
 						
-						if (regex_match(result.entityName, regex("#123|#[xX](00)?7[bB]|lcub|lbrace"))) {
+						if (result.character == '{') {
 							//nest.push("}");
 							inRollTemplateProperty = true;
 							return match_found(ROLLTEMPLATE_PROPERTY_START);
@@ -827,15 +1187,15 @@ struct Scanner {
 						return match_found(ROLLTEMPLATE_PROPERTY_START);
 					}
 				}
-				else if (valid_symbols[GROUPROLL_START]) {
+				else if (isValid(GROUPROLL_START)) {
 					nest.push(",}");
 					return match_found(GROUPROLL_START);
 				}
-				else if (valid_symbols[LEFT_BRACE]) {
+				else if (isValid(LEFT_BRACE)) {
 					return match_found(LEFT_BRACE);
 				}
 			}
-			else if ((c == 't' || c == 'T') && valid_symbols[TABLEROLL_START]) {
+			else if ((c == 't' || c == 'T') && isValid(TABLEROLL_START)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				
@@ -845,7 +1205,7 @@ struct Scanner {
 					result = getHtmlEntity();
 					c = lexer->lookahead;
 					
-					if (regex_match(result.entityName, regex("#91|#[xX](00)?5[bB]|lsqb|lbrack"))) {
+					if (result.character == '[') {
 						mark_end(lexer);
 						nest.push("]");
 						return match_found(TABLEROLL_START);
@@ -863,16 +1223,16 @@ struct Scanner {
 				c = advance(lexer);
 				mark_end(lexer);
 				
-				if (valid_symbols[ROLLQUERY_END] || valid_symbols[GROUPROLL_END]
-				 || valid_symbols[FLAG_END] || valid_symbols[ROLLTEMPLATE_PROPERTY_END]) {
-					if (valid_symbols[ROLLTEMPLATE_PROPERTY_END]) {
+				if (isValid(ROLLQUERY_END) || isValid(GROUPROLL_END)
+				 || isValid(FLAG_END) || isValid(ROLLTEMPLATE_PROPERTY_END)) {
+					if (isValid(ROLLTEMPLATE_PROPERTY_END)) {
 						if (c == '&') {
 							c = advance(lexer);
 							
 							result = getHtmlEntity();
 							c = lexer->lookahead;
 							
-							if (regex_match(result.entityName, regex("#125|#[xX](00)?7[dD]|rcub|rbrace"))) {
+							if (result.character == '}') {
 								//nest.pop();
 								inRollTemplateProperty = false;
 								return match_found(ROLLTEMPLATE_PROPERTY_END);
@@ -889,38 +1249,38 @@ struct Scanner {
 					else if (inRollTemplateProperty) {
 						if (c != '}') {
 							nest.pop();
-							if (valid_symbols[ROLLQUERY_END])
+							if (isValid(ROLLQUERY_END))
 								return match_found(ROLLQUERY_END);
-							if (valid_symbols[GROUPROLL_END])
+							if (isValid(GROUPROLL_END))
 								return match_found(GROUPROLL_END);
-							if (valid_symbols[FLAG_END])
+							if (isValid(FLAG_END))
 								return match_found(FLAG_END);
 						}
 					}
 					else {
 						nest.pop();
-						if (valid_symbols[ROLLQUERY_END])
+						if (isValid(ROLLQUERY_END))
 							return match_found(ROLLQUERY_END);
-						if (valid_symbols[GROUPROLL_END])
+						if (isValid(GROUPROLL_END))
 							return match_found(GROUPROLL_END);
-						if (valid_symbols[FLAG_END])
+						if (isValid(FLAG_END))
 							return match_found(FLAG_END);
 					}
 				}
-				else if (valid_symbols[RIGHT_BRACE]) {
+				else if (isValid(RIGHT_BRACE)) {
 					return match_found(RIGHT_BRACE);
 				}
 			}
-			else if (c == ']' && (valid_symbols[INLINEROLL_END] || valid_symbols[LABEL_END]
-			 || valid_symbols[TABLEROLL_END])) {
+			else if (c == ']' && (isValid(INLINEROLL_END) || isValid(LABEL_END)
+			 || isValid(TABLEROLL_END))) {
 				c = advance(lexer);
 				mark_end(lexer);
 				
-				if (valid_symbols[LABEL_END]) {
+				if (isValid(LABEL_END)) {
 					//nest.pop();
 					return match_found(LABEL_END);
 				}
-				else if (valid_symbols[TABLEROLL_END]) {
+				else if (isValid(TABLEROLL_END)) {
 					nest.pop();
 					return match_found(TABLEROLL_END);
 				}
@@ -930,39 +1290,39 @@ struct Scanner {
 					result = getHtmlEntity();
 					c = lexer->lookahead;
 					
-					if (checkEntity(result, {INLINEROLL_END}, ']', "#93|#[xX](00)?5[dD]|rsqb|rbrack")) {
+					if (checkEntity(result, {INLINEROLL_END}, ']')) {
 						return match_found(INLINEROLL_END);
 					}
 				}
-				else if (c == ']' && valid_symbols[INLINEROLL_END] && nest.isSafe(']')) {
+				else if (c == ']' && isValid(INLINEROLL_END) && nest.isSafe(']')) {
 					c = advance(lexer);
 					mark_end(lexer);
 					return match_found(INLINEROLL_END);
 				}
 			}
-			else if (c == ')' && valid_symbols[BUTTON_END]) {
+			else if (c == ')' && isValid(BUTTON_END)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				nest.pop();
 				return match_found(BUTTON_END);
 			}
-			else if (c == ')' && valid_symbols[RIGHT_PAREN]) {
+			else if (c == ')' && isValid(RIGHT_PAREN)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				return match_found(RIGHT_PAREN);
 			}
 			
-			else if (c == '|' && valid_symbols[PIPE]) {
+			else if (c == '|' && (isValid(PIPE) || isValid(DEFAULT_PIPE))) {
 				c = advance(lexer);
 				mark_end(lexer);
-				return match_found(PIPE);
+				return match_found(pipeType(c));
 			}
-			else if (c == ',' && valid_symbols[COMMA]) {
+			else if (c == ',' && isValid(COMMA)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				return match_found(COMMA);
 			}
-			else if (c == ':' && valid_symbols[COLON]) {
+			else if (c == ':' && isValid(COLON)) {
 				c = advance(lexer);
 				mark_end(lexer);
 				return match_found(COLON);
@@ -972,8 +1332,139 @@ struct Scanner {
 		return no_match();
 	}
 	
+	
+	/*╔════════════════════════════════════════════════════════════
+	  ║ Roll query separators
+	  ╚╤═══════════════════════════════════════════════════════════*/
+	 /*│ After a roll query's prompt, the rest of the query is either a default
+	   │ value or a list of options, and the parser can't tell which until it
+	   │ reaches the end of the first option. So when the first separator is
+	   │ found, the scanner looks ahead (without moving the end of the token)
+	   │ for another separator of the same query. If there is one, the
+	   │ separator is a PIPE like all the rest; otherwise it's a DEFAULT_PIPE.
+	   │ 
+	   │ A separator or closing brace belongs to this query if it's raw and
+	   │ safe at the current depth, or if it was encoded as many times as the
+	   │ query's own delimiters. One that was encoded fewer times belongs to
+	   │ an enclosing element, so the query ends there. Attributes and
+	   │ abilities are skipped, since they can contain a raw "|".
+	   └─────────────────────────────*/
+	
+	//(`c` is the character after the separator, and the end of the token has already been marked)
+	int pipeType(int32_t c) {
+		if (!isValid(DEFAULT_PIPE)) return PIPE;
+		if (!isValid(PIPE)) return DEFAULT_PIPE;
+		return separatorFollows(c) ? PIPE : DEFAULT_PIPE;
+	}
+	
+	bool separatorFollows(int32_t c) {
+		unsigned ownEncoding = nest.depth() - 1 + (inRollTemplateProperty?1:0);
+		EntityName entityName;
+		
+		while (c != 0) {
+			if (c == '&') {
+				advance(lexer);
+				
+				char character = 0;
+				unsigned timesEncoded = 0;
+				do {
+					getNextEntityName(lexer, entityName, character);
+					if (entityName.empty()) break;
+					timesEncoded++;
+				} while (character == '&' && timesEncoded < limits.maxEntityChain);
+				c = lexer->lookahead;
+				
+				if (timesEncoded == 0 || timesEncoded > ownEncoding) continue;
+				if (character == '|' || character == '}') return character == '|' && timesEncoded == ownEncoding;
+			}
+			else if (c == '@' || c == '%') {
+				c = advance(lexer);
+				if (c == '{') {
+					while (c != 0 && c != '}') c = advance(lexer);
+					if (c != 0) c = advance(lexer);
+				}
+			}
+			else if (c == '|' || c == '}') {
+				return c == '|' && nest.isSafe(c);
+			}
+			else {
+				c = advance(lexer);
+			}
+		}
+		
+		return false;
+	}
+	
+	
+	/*╔════════════════════════════════════════════════════════════
+	  ║ Text
+	  ╚╤═══════════════════════════════════════════════════════════*/
+	 /*│ Consume as long a run of plain text as possible. It stops before
+	   │ anything that could start another valid symbol (including "@{" and
+	   │ "%{"), a hash, or a delimiter that's unsafe at the current depth.
+	   │ 
+	   │ A character that can't start a run is left to the rest of the
+	   │ scanner, or to the grammar's single-character fallback.
+	   └─────────────────────────────*/
+	
+	bool scanText(int32_t c) {
+		unsigned length = 0;
+		
+		while (continuesText(c)) {
+			if (c == '@' || c == '%') {
+				//the run ends here if this is the start of an attribute or ability
+				mark_end(lexer);
+				c = advance(lexer);
+				if (c == '{') return length > 0 ? match_found(TEXT) : no_match();
+			}
+			else {
+				c = advance(lexer);
+			}
+			length++;
+		}
+		
+		mark_end(lexer);
+		return match_found(TEXT);
+	}
+	
+	
+	/*╔════════════════════════════════════════════════════════════
+	  ║ Error recovery
+	  ╚╤═══════════════════════════════════════════════════════════*/
+	 /*│ Once the recovery budget is spent, the rest of the input is a single
+	   │ text token. The parser can only skip it (or end the current element
+	   │ with it), so it reaches the end of the input without exploring any
+	   │ further, and the tree is complete up to where things went wrong.
+	   │ 
+	   │ Only the tokens the scanner matches count against the budget, since
+	   │ the count is restored along with the rest of the state before every
+	   │ scan. But while recovering, almost every token is one of the
+	   │ scanner's, mostly runs of text.
+	   │ 
+	   │ The count starts over at the first scan after the parser has
+	   │ recovered, so each error gets the whole budget, and outside of
+	   │ recovery the count is always zero. That keeps the serialized state
+	   │ of tokens after an error the same as it would be without the budget,
+	   │ so an incremental parse can still reuse them.
+	   └─────────────────────────────*/
+	
+	bool giveUp(int32_t c) {
+		limitsReached |= ROLL20_SCRIPT_LIMIT_RECOVERY_BUDGET;
+		
+		while (c != 0) c = advance(lexer);
+		mark_end(lexer);
+		
+		//delimiters left unpaired no longer matter
+		while (nest.depth() > 0) nest.pop();
+		inRollTemplateProperty = false;
+		
+		return match_found(TEXT);
+	}
+
 };
 
+typedef BasicScanner<CachedValidSymbols> Scanner;
+
 
 
 }	//namespace
@@ -986,7 +1477,6 @@ struct Scanner {
 extern "C" {
 
 void *tree_sitter_roll20_script_external_scanner_create() {
-	Debug.log(color(noChange, brightMagenta)+"                                        ");
 	return new Scanner();
 }
 
@@ -1010,4 +1500,32 @@ void tree_sitter_roll20_script_external_scanner_destroy(void *payload) {
 	delete scanner;
 }
 
+void tree_sitter_roll20_script_get_scanner_limits(Roll20ScriptScannerLimits *limits) {
+	limits->recovery_budget = limitSettings.recoveryBudget.load(memory_order_relaxed);
+	limits->max_depth = limitSettings.maxDepth.load(memory_order_relaxed);
+	limits->max_entity_chain = limitSettings.maxEntityChain.load(memory_order_relaxed);
+}
+
+void tree_sitter_roll20_script_set_scanner_limits(const Roll20ScriptScannerLimits *limits) {
+	limitSettings.recoveryBudget.store(limits->recovery_budget, memory_order_relaxed);
+	limitSettings.maxDepth.store(limits->max_depth, memory_order_relaxed);
+	limitSettings.maxEntityChain.store(limits->max_entity_chain, memory_order_relaxed);
+}
+
+unsigned tree_sitter_roll20_script_take_limits_reached(void) {
+	unsigned reached = limitsReached;
+	limitsReached = 0;
+	return reached;
+}
+
+size_t tree_sitter_roll20_script_decode_entities(const char *text, size_t length, char *decoded) {
+	return decodeEntities(text, length, decoded);
+}
+
+#ifdef ROLL20_SCRIPT_SCANNER_TRACE
+size_t tree_sitter_roll20_script_scanner_trace(Roll20ScriptTraceEvent *events, size_t count) {
+	return traceEvents.copy(events, count);
+}
+#endif
+
 }	//extern "C"
@@ -0,0 +1,34 @@
+#ifndef TREE_SITTER_ROLL20_SCRIPT_SCANNER_ENTITIES_H_
+#define TREE_SITTER_ROLL20_SCRIPT_SCANNER_ENTITIES_H_
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Decoding HTML entities
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ When an option of a roll query is chosen, Roll20 decodes its value once
+   │ and parses the result as a script of its own. This decodes text the
+   │ same way, recognizing the same entities as the scanner does:
+   │ • each HTML5 name followed by a semicolon (e.g., "&vert;").
+   │ • each numeric code the scanner reads as an ASCII character (e.g.,
+   │   "&#124;" or "&#x7C;").
+   │
+   │ The entities are decoded left to right, and what they decode to isn't
+   │ decoded again (e.g., "&amp;#124;" becomes "&#124;"). Anything else,
+   │ including a numeric code for a character outside of ASCII, is left as
+   │ it is.
+   └───────────────────────────────────────────────────────────*/
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//Decodes the entities in UTF-8 `text` once, into `decoded`, and returns the number of bytes written.
+// Decoding never lengthens the text, so `decoded` needs room for `length` bytes.
+size_t tree_sitter_roll20_script_decode_entities(const char *text, size_t length, char *decoded);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_ROLL20_SCRIPT_SCANNER_ENTITIES_H_
@@ -0,0 +1,68 @@
+#ifndef TREE_SITTER_ROLL20_SCRIPT_SCANNER_LIMITS_H_
+#define TREE_SITTER_ROLL20_SCRIPT_SCANNER_LIMITS_H_
+
+/*╔════════════════════════════════════════════════════════════
+  ║ External scanner limits
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Limits on how much work the scanner does on malformed input. They apply
+   │ to every scanner created after they're set (i.e., to parsers whose
+   │ language is set afterward), so set them before creating parsers.
+   │
+   │ Recovery budget: while the parser is recovering from an error, each
+   │ token the scanner matches counts against the budget. Once it's spent,
+   │ the scanner stops trying to pair delimiters, and the rest of the input
+   │ becomes a single text token, so the parser finishes with a partial
+   │ tree instead of searching for a way to make the rest of the input fit.
+   │ Each error has a budget of its own: the count starts over once the
+   │ parser has recovered.
+   │
+   │ Maximum depth: how many delimited elements (roll queries, labels,
+   │ buttons, group rolls, table rolls, flags) can be nested within each
+   │ other. At the limit, delimiters that would start another one are plain
+   │ text.
+   │
+   │ Maximum entity chain: how many times an HTML entity can be decoded
+   │ (e.g., "&amp;amp;vert;" is three times). Past the limit, the rest of the
+   │ chain is plain text. An entity is never decoded more times than the
+   │ depth it's at, so this only matters if it's less than the maximum depth.
+   │
+   │ The scanner records which limits were reached on the thread that ran
+   │ the parse, so the embedding application can tell when a tree is only
+   │ partial. Tokens reused from an old tree by an incremental parse are not
+   │ scanned again, so they don't report anything.
+   └───────────────────────────────────────────────────────────*/
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET 64
+#define ROLL20_SCRIPT_DEFAULT_MAX_DEPTH 32
+#define ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN 16
+
+//flags for the limits that were reached
+#define ROLL20_SCRIPT_LIMIT_RECOVERY_BUDGET 0x1
+#define ROLL20_SCRIPT_LIMIT_DEPTH 0x2
+#define ROLL20_SCRIPT_LIMIT_ENTITY_CHAIN 0x4
+
+typedef struct {
+  uint16_t recovery_budget;   //number of tokens the scanner matches while recovering from an error before
+                              // it gives up on the rest of the input
+  uint8_t max_depth;          //maximum number of nested elements
+  uint8_t max_entity_chain;   //maximum number of times an HTML entity is decoded
+} Roll20ScriptScannerLimits;
+
+void tree_sitter_roll20_script_get_scanner_limits(Roll20ScriptScannerLimits *limits);
+void tree_sitter_roll20_script_set_scanner_limits(const Roll20ScriptScannerLimits *limits);
+
+//Returns the flags (ROLL20_SCRIPT_LIMIT_*) for the limits that were reached by the scanners used on
+// the calling thread since the last call, and clears them.
+unsigned tree_sitter_roll20_script_take_limits_reached(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_ROLL20_SCRIPT_SCANNER_LIMITS_H_
@@ -0,0 +1,45 @@
+#ifndef TREE_SITTER_ROLL20_SCRIPT_SCANNER_TRACE_H_
+#define TREE_SITTER_ROLL20_SCRIPT_SCANNER_TRACE_H_
+
+/*╔════════════════════════════════════════════════════════════
+  ║ External scanner tracing
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ When src/scanner.cc is compiled with ROLL20_SCRIPT_SCANNER_TRACE defined,
+   │ each thread records the most recent scans run on it in a ring buffer.
+   │ After a parse (e.g., a slow one), the thread that ran it can copy out
+   │ its events. If other parses ran on the thread in between (e.g., taking
+   │ turns), their events are mixed in.
+   │
+   │ Without the flag, tracing compiles away and the function below is not
+   │ defined.
+   └───────────────────────────────────────────────────────────*/
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define ROLL20_SCRIPT_TRACE_CAPACITY 256
+#define ROLL20_SCRIPT_TRACE_NO_MATCH 0xFF
+
+typedef struct {
+  uint32_t scan;            //sequence number of the scan on its thread
+  uint16_t length;          //number of characters in the token (or traversed, if there was no match)
+  uint8_t symbol;           //the external token that was found (index in the grammar's
+                            // `externals`), or ROLL20_SCRIPT_TRACE_NO_MATCH
+  uint8_t depth;            //nesting depth when the scan finished
+  uint8_t times_decoded;    //number of times the last HTML entity in the token was decoded
+  uint8_t reserved[3];
+} Roll20ScriptTraceEvent;
+
+//Copies up to `count` of the most recent events (oldest first) recorded on the calling thread.
+// Returns the number of events copied.
+size_t tree_sitter_roll20_script_scanner_trace(Roll20ScriptTraceEvent *events, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // TREE_SITTER_ROLL20_SCRIPT_SCANNER_TRACE_H_
@@ -0,0 +1,97 @@
+//Parses the macros in a file or a stream of bytes (e.g., a multi-GB export) without first decoding them
+// into strings.
+//
+//The bytes are split into chat messages where they are (see splitMessages in src/prescan.h), and each
+// message is parsed as UTF-8 where it is too (see parseBytes in src/binding.cc). A file is mapped into
+// memory instead of being read, a window at a time (see mapFile in src/binding.cc), so nothing is copied
+// except a message that's split between two chunks of a stream.
+//
+//  for await (const { startIndex, endIndex, tree } of parseFile("export.txt")) ...
+//
+//Each message is { startIndex, endIndex, tree }: where it starts and ends in the file or stream (as byte
+// offsets), and its flattened tree, { hasError, startIndex, endIndex, nodeCount, types, nodes } (see
+// parseAsync in src/binding.cc). The tree's indices are byte offsets too, relative to the message's
+// `startIndex`; decode a node's text with `bytes.toString("utf8", ...)`. With `trees: false`, only the
+// named nodes are counted, and there are no `types` or `nodes`.
+
+const fs = require("fs");
+
+const Roll20Script = require("./index");
+
+const WINDOW_SIZE = 64 * 1024 * 1024;
+
+//Parses bytes[start, end).
+function parseBytes(bytes, start, end, trees) {
+  const tree = Roll20Script.parseBytes(bytes, start, end, { trees });
+  if (trees) tree.types = Roll20Script.types;
+  return tree;
+}
+
+//Splits `bytes` into messages. Unless they're the last bytes of the file or stream, the last message is
+// left out, since it might continue in the bytes that follow: it starts at `rest`.
+function messagesIn(bytes, last) {
+  let end = bytes.length;
+  if (!last) {
+    //a line break only ends a message once the line after it is known
+    end = bytes.lastIndexOf(0x0A) + 1;
+    if (end === 0) return { boundaries: [], rest: 0 };
+  }
+
+  const boundaries = Roll20Script.splitMessages(end < bytes.length ? bytes.subarray(0, end) : bytes);
+  if (last) return { boundaries, rest: bytes.length };
+  if (!boundaries.length) return { boundaries, rest: end };
+  return { boundaries: boundaries.slice(0, -2), rest: boundaries[boundaries.length - 2] };
+}
+
+function* parseMessages(bytes, offset, boundaries, trees) {
+  for (let i = 0; i < boundaries.length; i += 2) {
+    yield {
+      startIndex: offset + boundaries[i],
+      endIndex: offset + boundaries[i+1],
+      tree: parseBytes(bytes, boundaries[i], boundaries[i+1], trees),
+    };
+  }
+}
+
+//Parses the messages in a stream of Buffers (e.g., a readable stream without an encoding). A message
+// that's split between Buffers is copied into one.
+async function* parseChunks(chunks, { trees = true } = {}) {
+  let rest = null, offset = 0;
+  for await (const chunk of chunks) {
+    const bytes = rest && rest.length ? Buffer.concat([rest, chunk]) : chunk;
+    const messages = messagesIn(bytes, false);
+    yield* parseMessages(bytes, offset, messages.boundaries, trees);
+    rest = bytes.subarray(messages.rest);
+    offset += messages.rest;
+  }
+  if (rest && rest.length) {
+    yield* parseMessages(rest, offset, messagesIn(rest, true).boundaries, trees);
+  }
+}
+
+//Parses the messages in a file. Each window of it is mapped in turn, starting with the message that was
+// left unfinished at the end of the last one (a window grows if a message doesn't fit in it). Where
+// files can't be mapped, it's read as a stream instead.
+async function* parseFile(path, { window = WINDOW_SIZE, trees = true } = {}) {
+  if (!Roll20Script.mapFile) {
+    yield* parseChunks(fs.createReadStream(path, { highWaterMark: window }), { trees });
+    return;
+  }
+
+  const size = fs.statSync(path).size;
+  let offset = 0, length = window;
+  while (offset < size) {
+    const bytes = Roll20Script.mapFile(path, offset, length);
+    const last = offset + bytes.length >= size;
+    const messages = messagesIn(bytes, last);
+    if (!last && messages.rest === 0) {
+      length *= 2;
+      continue;
+    }
+    yield* parseMessages(bytes, offset, messages.boundaries, trees);
+    offset += messages.rest;
+    length = window;
+  }
+}
+
+module.exports = { parseChunks, parseFile };
@@ -0,0 +1,154 @@
+//Smoke test of the Node binding (src/binding.cc and index.js): calls each of its exports on inputs whose
+// results are known, e.g., the corpus inputs, whose trees tree-sitter test has already checked.
+//
+//Usage: node test/binding_test.js (once the addon is built, e.g., by npm install)
+
+const assert = require("assert");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+
+const Roll20Script = require("../index");
+const { loadCorpus, countNodes, test } = require("./driver");
+
+function parseAsync(source, options) {
+  return new Promise((resolve, reject) => {
+    Roll20Script.parseAsync(source, options, (error, tree) => error ? reject(error) : resolve(tree));
+  });
+}
+
+//a flattened tree's nodes as [type name, startIndex, endIndex, parent, ...]
+function named(nodes, types) {
+  const result = [];
+  for (let i = 0; i < nodes.length; i += 4) result.push(types[nodes[i]], nodes[i+1], nodes[i+2], nodes[i+3]);
+  return result;
+}
+
+test("the language", () => {
+  assert.strictEqual(Roll20Script.name, "roll20_script");
+  assert.ok(Roll20Script.types.includes("script"));
+  assert.ok(Roll20Script.types.includes("rollTemplate"));
+  assert.ok(Roll20Script.nodeTypeInfo.some(info => info.type === "script" && info.named));
+});
+
+test("the language's types are only built once", async () => {
+  const types = Roll20Script.types;
+  assert.strictEqual(Roll20Script.types, types);
+  assert.strictEqual(Roll20Script.parseBatch(["[[1]]"], { trees: true }).types, types);
+  assert.strictEqual((await parseAsync("[[1]]", { trees: true })).types, types);
+});
+
+test("findSyntax", () => {
+  assert.strictEqual(Roll20Script.findSyntax("plain text"), 10);
+  assert.strictEqual(Roll20Script.findSyntax("roll [[1d6]]"), 5);
+  //a Buffer's index counts bytes
+  assert.strictEqual(Roll20Script.findSyntax("é [[1]]"), 2);
+  assert.strictEqual(Roll20Script.findSyntax(Buffer.from("é [[1]]")), 3);
+});
+
+test("prescan", () => {
+  assert.deepStrictEqual(Roll20Script.prescan("plain text"), {
+    offset: 10,
+    script: { type: "script", text: "plain text" },
+  });
+  assert.deepStrictEqual(Roll20Script.prescan("roll [[1d6]]"), { offset: 5, script: null });
+});
+
+test("findTemplateProperties", () => {
+  assert.deepStrictEqual(Roll20Script.findTemplateProperties("&{template:t} {{a=1}} {{b=2}}"),
+    [0, 13, 14, 21, 22, 29]);
+  assert.strictEqual(Roll20Script.findTemplateProperties("{{a=1}}"), null);
+});
+
+test("splitMessages", () => {
+  assert.deepStrictEqual(Roll20Script.splitMessages("a\n\nb"), [0, 1, 3, 4]);
+  assert.deepStrictEqual(Roll20Script.splitMessages(Buffer.from("é\nb")), [0, 2, 3, 4]);
+  //a property that's still open continues onto the next line
+  assert.deepStrictEqual(Roll20Script.splitMessages("&{template:t} {{a=1\n}} {{b=2}}\nnext"), [0, 30, 31, 35]);
+});
+
+test("decodeEntities", () => {
+  assert.strictEqual(Roll20Script.decodeEntities("?{q&#124;a&comma;1&rcub; &amp;amp; é"), "?{q|a,1} &amp; é");
+});
+
+test("parseBatch, over the corpus", () => {
+  const corpus = loadCorpus();
+  const inputs = corpus.map(entry => entry.input);
+  const counted = Roll20Script.parseBatch(inputs);
+  const flattened = Roll20Script.parseBatch(inputs.map(input => Buffer.from(input)), { trees: true });
+  assert.strictEqual(counted.types, undefined);
+
+  corpus.forEach((entry, i) => {
+    const where = `${entry.file}: ${entry.name}`;
+    assert.strictEqual(counted.hasError[i], 0, where);
+    assert.strictEqual(counted.nodeCounts[i], countNodes(entry.tree), where);
+    assert.deepStrictEqual([counted.spans[2*i], counted.spans[2*i+1]], [0, entry.input.length], where);
+
+    const nodes = flattened.trees[i];
+    assert.strictEqual(flattened.nodeCounts[i], counted.nodeCounts[i], where);
+    assert.strictEqual(nodes.length, 4 * counted.nodeCounts[i], where);
+    assert.strictEqual(flattened.types[nodes[0]], "script", where);
+    assert.strictEqual(nodes[3], -1, where);
+    assert.strictEqual(flattened.spans[2*i+1], Buffer.byteLength(entry.input), where);
+  });
+});
+
+test("parseBatch, with a source it can't parse", () => {
+  const result = Roll20Script.parseBatch(["[[1]]", 42]);
+  assert.deepStrictEqual([...result.hasError], [0, 1]);
+  assert.deepStrictEqual([...result.spans], [0, 5, 0, 0]);
+  assert.throws(() => Roll20Script.parseBatch("[[1]]"), TypeError);
+});
+
+test("parseAsync", async () => {
+  const source = "&{template:t} {{a=[[1d6]]}} ?{q|1}";
+  const batch = Roll20Script.parseBatch([source], { trees: true });
+  const tree = await parseAsync(source, { trees: true });
+  assert.strictEqual(tree.hasError, false);
+  assert.deepStrictEqual([tree.startIndex, tree.endIndex], [0, source.length]);
+  assert.strictEqual(tree.nodeCount, batch.nodeCounts[0]);
+  assert.deepStrictEqual(named(tree.nodes, tree.types), named(batch.trees[0], batch.types));
+
+  const counted = await parseAsync(Buffer.from(source), {});
+  assert.strictEqual(counted.nodeCount, batch.nodeCounts[0]);
+  assert.strictEqual(counted.nodes, undefined);
+
+  assert.throws(() => Roll20Script.parseAsync(source, {}), TypeError);
+  assert.throws(() => Roll20Script.parseAsync(42, {}, () => {}), TypeError);
+});
+
+test("cancelParse, after the parse has called back", async () => {
+  let id = -1;
+  await new Promise((resolve, reject) => {
+    id = Roll20Script.parseAsync("[[1]]", {}, error => error ? reject(error) : resolve());
+  });
+  Roll20Script.cancelParse(id);
+});
+
+test("parseBytes", () => {
+  const source = "é [[1d6]] ?{q|1}";
+  const bytes = Buffer.from(`ab${source}cd`);
+  const batch = Roll20Script.parseBatch([Buffer.from(source)], { trees: true });
+  const tree = Roll20Script.parseBytes(bytes, 2, bytes.length - 2, { trees: true });
+  assert.strictEqual(tree.hasError, false);
+  assert.deepStrictEqual([tree.startIndex, tree.endIndex], [0, Buffer.byteLength(source)]);
+  assert.deepStrictEqual(named(tree.nodes, Roll20Script.types), named(batch.trees[0], batch.types));
+  assert.strictEqual(Roll20Script.parseBytes(bytes, 2, bytes.length - 2).nodes, undefined);
+  assert.throws(() => Roll20Script.parseBytes(source), TypeError);
+});
+
+test("mapFile", () => {
+  if (!Roll20Script.mapFile) return;  //(not on Windows)
+  const directory = fs.mkdtempSync(path.join(os.tmpdir(), "roll20-script-"));
+  const file = path.join(directory, "macro.txt");
+  try {
+    fs.writeFileSync(file, "0123456789");
+    assert.strictEqual(Roll20Script.mapFile(file, 3, 4).toString(), "3456");
+    assert.strictEqual(Roll20Script.mapFile(file, 8, 100).toString(), "89");
+    assert.strictEqual(Roll20Script.mapFile(file, 10, 1).length, 0);
+    assert.throws(() => Roll20Script.mapFile(path.join(directory, "missing.txt"), 0, 1), { code: "ENOENT" });
+  }
+  finally {
+    fs.rmSync(directory, { recursive: true });
+  }
+});
@@ -0,0 +1,64 @@
+//What the JS tests share: the corpus, and a runner for the tests in a file.
+
+const fs = require("fs");
+const path = require("path");
+
+const CORPUS = path.join(__dirname, "..", "corpus");
+
+function isRule(line, c) {
+  return line.length >= 3 && [...line].every(d => d === c);
+}
+
+//The tests in the corpus files: { file, name, input, tree }, where `tree` is the expected S-expression with
+// its whitespace collapsed (see loadCorpus in scanner_driver.h).
+function loadCorpus(directory = CORPUS) {
+  const tests = [];
+  for (const file of fs.readdirSync(directory).filter(name => name.endsWith(".txt")).sort()) {
+    const lines = fs.readFileSync(path.join(directory, file), "utf8").split(/\r?\n/);
+    for (let i = 0; i + 2 < lines.length; i++) {
+      if (!isRule(lines[i], "=") || !isRule(lines[i+2], "=")) continue;
+      const name = lines[i+1];
+      let j = i + 3;
+      while (j < lines.length && !isRule(lines[j], "-")) j++;
+      let k = j + 1;
+      while (k < lines.length && !(isRule(lines[k], "=") && k + 2 < lines.length && isRule(lines[k+2], "="))) k++;
+      tests.push({
+        file,
+        name,
+        input: lines.slice(i + 3, j).join("\n"),
+        tree: lines.slice(j + 1, k).join(" ").replace(/\s+\)/g, ")").replace(/\s+/g, " ").trim(),
+      });
+      i = k - 1;
+    }
+  }
+  return tests;
+}
+
+//the number of named nodes in an S-expression
+function countNodes(tree) {
+  return (tree.match(/\(/g) || []).length;
+}
+
+const tests = [];
+
+//Adds a test. `run` throws (e.g., an AssertionError) or returns a promise that rejects if the test fails.
+function test(name, run) {
+  tests.push({ name, run });
+}
+
+//Runs the tests one at a time, once the file has added them all.
+setImmediate(async () => {
+  let failures = 0;
+  for (const { name, run } of tests) {
+    try {
+      await run();
+    } catch (error) {
+      failures++;
+      console.error(`FAIL: ${name}\n${error.stack}`);
+    }
+  }
+  console.log(`${tests.length - failures} tests passed, ${failures} failures`);
+  process.exitCode = failures ? 1 : 0;
+});
+
+module.exports = { loadCorpus, countNodes, test };
@@ -0,0 +1,9 @@
+//The parser's table of external lex states, which src/parser.c keeps static.
+
+#include "../src/parser.c"
+
+const bool *roll20_script_test_external_lex_states(unsigned *count, unsigned *width) {
+  *count = sizeof(ts_external_scanner_states) / sizeof(ts_external_scanner_states[0]);
+  *width = EXTERNAL_TOKEN_COUNT;
+  return &ts_external_scanner_states[0][0];
+}
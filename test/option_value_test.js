@@ -0,0 +1,127 @@
+//Tests optionValueScript in index.js and decodeEntities in src/binding.cc: the script of each option value in
+// the corpus against a parse of the value decoded by hand, and the values whose script isn't their subtree.
+//
+//Usage: node test/option_value_test.js (once the addon is built, e.g., by npm install)
+
+const assert = require("assert");
+
+const Roll20Script = require("../index");
+const { loadCorpus, test } = require("./driver");
+
+//a flattened tree's nodes as [type name, startIndex, endIndex, parent, ...]
+function named(nodes, types) {
+  const result = [];
+  for (let i = 0; i < nodes.length; i += 4) result.push(types[nodes[i]], nodes[i+1], nodes[i+2], nodes[i+3]);
+  return result;
+}
+
+//the entity names in the corpus's option values
+const NAMES = { amp: "&", lt: "<", vert: "|", comma: ",", lcub: "{", rcub: "}", quest: "?" };
+
+//Decodes a value once, as Roll20 does (only the entities above, and ASCII codes).
+function decode(value) {
+  return value.replace(/&(#[0-9]{1,3}|#x[0-9A-Fa-f]{2}|[A-Za-z]+);/g, (entity, name) => {
+    if (name[0] !== "#") {
+      assert.ok(name in NAMES, entity);
+      return NAMES[name];
+    }
+    const code = name[1] === "x" ? parseInt(name.slice(2), 16) : parseInt(name.slice(1), 10);
+    return code < 0x80 && !/^#0/.test(name) ? String.fromCharCode(code) : entity;
+  });
+}
+
+//Each `option_value` node in `source`: its text, and the types of the nodes in its subtree (preorder).
+function optionValues(source) {
+  const batch = Roll20Script.parseBatch([source], { trees: true });
+  const nodes = named(batch.trees[0], batch.types);
+  const values = [];
+  for (let i = 0; i < nodes.length; i += 4) {
+    if (nodes[i] !== "option_value") continue;
+    const subtree = [];
+    const inside = new Set([i/4]);
+    for (let j = i + 4; j < nodes.length; j += 4) {
+      if (!inside.has(nodes[j+3])) continue;
+      inside.add(j/4);
+      subtree.push(nodes[j]);
+    }
+    values.push({ text: source.slice(nodes[i+1], nodes[i+2]), subtree });
+  }
+  return values;
+}
+
+//the types of a script's nodes below the root (preorder)
+function types(script) {
+  return named(script.nodes, script.types).filter((_, i) => i % 4 === 0).slice(1);
+}
+
+//the types of the elements (i.e., not text, which decoding changes)
+function elements(types) {
+  return types.filter(type => type !== "text" && type !== "htmlEntity");
+}
+
+test("decodeEntities", () => {
+  assert.strictEqual(Roll20Script.decodeEntities("?{p&#124;b&#125;c"), "?{p|b}c");
+  assert.strictEqual(Roll20Script.decodeEntities("&vert;&#x7C;&#x007c;&hearts;é😀"), "|||♥é😀");
+  //what an entity decodes to isn't decoded again
+  assert.strictEqual(Roll20Script.decodeEntities("&amp;#124; &amp;amp;"), "&#124; &amp;");
+  //neither are names without a semicolon, unknown names, or codes the scanner doesn't read as characters
+  assert.strictEqual(Roll20Script.decodeEntities("&lt &nope; &#0124; &#200; &#;"), "&lt &nope; &#0124; &#200; &#;");
+});
+
+test("option values in the corpus", () => {
+  let count = 0;
+  for (const { name, input } of loadCorpus()) {
+    for (const value of optionValues(input)) {
+      const where = `${name}: ${value.text}`;
+      const script = Roll20Script.optionValueScript(value.text);
+      const text = decode(value.text);
+      assert.strictEqual(script.text, text, where);
+
+      const batch = Roll20Script.parseBatch([text], { trees: true });
+      assert.strictEqual(script.hasError, batch.hasError[0] === 1, where);
+      assert.deepStrictEqual(named(script.nodes, script.types), named(batch.trees[0], batch.types), where);
+
+      //A value whose script parses has the same elements as its subtree. (The corpus's properties without
+      // a template's flag only parse within a roll template.)
+      if (value.subtree.includes("template_property") && !value.subtree.includes("flag")) {
+        assert.strictEqual(script.hasError, true, where);
+        continue;
+      }
+      assert.strictEqual(script.hasError, false, where);
+      assert.deepStrictEqual(elements(types(script)), elements(value.subtree), where);
+      count++;
+    }
+  }
+  assert.ok(count > 20, `${count} option values`);
+});
+
+test("a value that's a roll template", () => {
+  const [value] = optionValues("?{Attack|Sword,&{template:default&#125; {{name=Sword&#125;&#125;|Axe,1}");
+  assert.ok(value.subtree.includes("flag") && value.subtree.includes("template_property"));
+  assert.ok(!value.subtree.includes("rollTemplate"));
+
+  const script = Roll20Script.optionValueScript(value.text);
+  assert.strictEqual(script.text, "&{template:default} {{name=Sword}}");
+  assert.strictEqual(script.hasError, false);
+  assert.strictEqual(types(script)[0], "rollTemplate");
+  assert.deepStrictEqual(elements(types(script)).slice(1), elements(value.subtree));
+});
+
+test("a value that's a roll command", () => {
+  for (const source of ["?{Roll|Attack,/r 1d20|None,0}", "?{Roll|Attack,&#47;r 1d20|None,0}"]) {
+    const [value] = optionValues(source);
+    assert.ok(!value.subtree.includes("rollCommand"), source);
+
+    const script = Roll20Script.optionValueScript(value.text);
+    assert.strictEqual(script.text, "/r 1d20", source);
+    assert.strictEqual(script.hasError, false, source);
+    assert.strictEqual(types(script)[0], "rollCommand", source);
+  }
+});
+
+test("a node, or its text", () => {
+  const text = "?{p&#124;b&#125;c";
+  assert.deepStrictEqual(Roll20Script.optionValueScript({ type: "option_value", text }),
+    Roll20Script.optionValueScript(text));
+  assert.strictEqual(Roll20Script.optionValueScript("[[1d6]]").text, "[[1d6]]");
+});
@@ -0,0 +1,129 @@
+//Tests parallel.js against single-threaded parses: roll template macros split between their properties,
+// and a file of macros split into messages.
+//
+//Usage: node test/parallel_test.js (once the addon is built, e.g., by npm install)
+
+const assert = require("assert");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+
+const Roll20Script = require("../index");
+const { parseTemplateParallel, parseMessages, MessageCache } = require("../parallel");
+const { parseFile } = require("../stream");
+const { loadCorpus, test } = require("./driver");
+
+//a flattened tree's nodes as [type name, startIndex, endIndex, parent, ...]
+function named(nodes, types) {
+  const result = [];
+  for (let i = 0; i < nodes.length; i += 4) result.push(types[nodes[i]], nodes[i+1], nodes[i+2], nodes[i+3]);
+  return result;
+}
+
+//the nodes of a parse on one thread, in one go
+function wholeTree(source) {
+  const batch = Roll20Script.parseBatch([source], { trees: true });
+  return { nodes: named(batch.trees[0], batch.types), hasError: batch.hasError[0] === 1 };
+}
+
+//(a query that ends a property needs a space before the "}}", or "}}}" would end the property first)
+function sheetMacro(n) {
+  let macro = "&{template:atkdmg} {{mod=+5}} {{rname=Longsword}} ";
+  for (let i = 0; i < n; i++) {
+    macro += `{{attack${i}=[[1d20+@{atk${i}}]] ?{Advantage|Normal,0|Advantage,1|Disadvantage,2} }} `;
+    macro += `{{damage${i}=[[?{Damage|2d6}+floor(@{dmg${i}}/2)]] [[{1d6,@{bonus${i}}}kh1]]}} `;
+  }
+  return macro;
+}
+
+test("roll templates split between threads", async () => {
+  const sources = [sheetMacro(1), sheetMacro(20), "&{template:t} {{a=1}} {{b=[[2]]}}", "@{w} &{template:t} {{a=1}}{{b=2}}"];
+  for (const source of sources) {
+    const whole = wholeTree(source);
+    assert.strictEqual(whole.hasError, false, source);
+    for (const threads of [1, 2, 3, 4, 8]) {
+      const result = await parseTemplateParallel(source, { threads });
+      const where = `${threads} threads: ${source.slice(0, 60)}`;
+      assert.strictEqual(result.hasError, false, where);
+      if (threads > 1) assert.ok(result.parts > 1, where);
+      else assert.strictEqual(result.parts, 1, where);
+      assert.deepStrictEqual(named(result.nodes, result.types), whole.nodes, where);
+    }
+  }
+});
+
+test("roll templates in the corpus", async () => {
+  for (const { name, input } of loadCorpus()) {
+    const boundaries = Roll20Script.findTemplateProperties(input);
+    if (!boundaries || boundaries.length < 6) continue;
+    const whole = wholeTree(input);
+    const result = await parseTemplateParallel(input, { threads: 4 });
+    assert.strictEqual(result.hasError, whole.hasError, name);
+    assert.deepStrictEqual(named(result.nodes, result.types), whole.nodes, name);
+  }
+});
+
+test("a split that doesn't parse is parsed in one go", async () => {
+  //("}}}" ends the first property and leaves its query open)
+  const source = "&{template:t} {{a=?{q|x}}} {{c=2}} {{d=3}}";
+  assert.strictEqual(Roll20Script.findTemplateProperties(source).length, 2 + 2*3);
+  const whole = wholeTree(source);
+  const result = await parseTemplateParallel(source, { threads: 4 });
+  assert.strictEqual(result.parts, 1);
+  assert.strictEqual(result.hasError, whole.hasError);
+  assert.deepStrictEqual(named(result.nodes, result.types), whole.nodes);
+});
+
+const FILE_MACRO = [
+  "/em draws a sword",
+  sheetMacro(10),
+  "",
+  "&{template:default} {{name=Two",
+  "lines}} {{roll=[[1d6]]}}",
+  "?{Bonus|0} [[1d20+?{Bonus|0}]]",
+  sheetMacro(10),
+].join("\n");
+
+test("a file of macros, split into messages", async () => {
+  const directory = fs.mkdtempSync(path.join(os.tmpdir(), "roll20-script-"));
+  const file = path.join(directory, "macros.txt");
+  try {
+    fs.writeFileSync(file, FILE_MACRO);
+    const source = Roll20Script.mapFile
+      ? Roll20Script.mapFile(file, 0, fs.statSync(file).size).toString()
+      : fs.readFileSync(file, "utf8");
+    assert.strictEqual(source, FILE_MACRO);
+
+    const cache = new MessageCache();
+    const messages = await parseMessages(source, { cache });
+    const boundaries = Roll20Script.splitMessages(source);
+    assert.strictEqual(messages.length, boundaries.length / 2);
+    assert.strictEqual(messages.length, 5);
+    messages.forEach(({ startIndex, endIndex, tree }, i) => {
+      assert.deepStrictEqual([startIndex, endIndex], [boundaries[2*i], boundaries[2*i+1]]);
+      const whole = wholeTree(source.slice(startIndex, endIndex));
+      assert.strictEqual(tree.hasError, whole.hasError, `message ${i}`);
+      assert.deepStrictEqual(named(tree.nodes, tree.types), whole.nodes, `message ${i}`);
+    });
+    //(the same sheet macro twice is parsed once)
+    assert.strictEqual(messages[1].tree, messages[4].tree);
+
+    //the same messages streamed from the file (all ASCII, so bytes and characters agree)
+    const streamed = [];
+    for await (const { startIndex, endIndex, tree } of parseFile(file, { window: 256 })) {
+      streamed.push({ startIndex, endIndex, nodes: named(tree.nodes, tree.types) });
+    }
+    assert.deepStrictEqual(streamed, messages.map(({ startIndex, endIndex, tree }) => ({
+      startIndex, endIndex, nodes: named(tree.nodes, tree.types),
+    })));
+
+    //after an edit, only the message that changed is parsed again
+    const edited = source.replace("/em draws a sword", "/em draws a dagger");
+    const again = await parseMessages(edited, { cache });
+    assert.notStrictEqual(again[0].tree, messages[0].tree);
+    for (let i = 1; i < messages.length; i++) assert.strictEqual(again[i].tree, messages[i].tree, `message ${i}`);
+  }
+  finally {
+    fs.rmSync(directory, { recursive: true });
+  }
+});
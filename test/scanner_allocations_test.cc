@@ -0,0 +1,67 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Allocation test
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Scans the whole corpus (see scanner_driver.h) with a global allocator
+   │ that counts, and fails if the scanner allocated anything between being
+   │ created and being destroyed.
+   │
+   │ Usage: scanner_allocations_test [corpus directory]
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<bool> counting{false};
+std::atomic<unsigned long> allocations{0};
+
+void *allocate(size_t size) {
+	if (counting.load(std::memory_order_relaxed)) allocations++;
+	void *memory = malloc(size ? size : 1);
+	if (!memory) throw std::bad_alloc();
+	return memory;
+}
+
+}	//namespace
+
+void *operator new(size_t size) { return allocate(size); }
+void *operator new[](size_t size) { return allocate(size); }
+void *operator new(size_t size, const std::nothrow_t &) noexcept {
+	try { return allocate(size); } catch (...) { return nullptr; }
+}
+void *operator new[](size_t size, const std::nothrow_t &) noexcept {
+	try { return allocate(size); } catch (...) { return nullptr; }
+}
+void operator delete(void *memory) noexcept { free(memory); }
+void operator delete[](void *memory) noexcept { free(memory); }
+void operator delete(void *memory, size_t) noexcept { free(memory); }
+void operator delete[](void *memory, size_t) noexcept { free(memory); }
+
+int main(int argc, char **argv) {
+	const char *corpus = argc > 1 ? argv[1] : "../corpus";
+	
+	std::vector<driver::Input> inputs = driver::loadCorpus(corpus);
+	driver::ExternalLexStates states;
+	if (inputs.empty()) {
+		fprintf(stderr, "no tests found in %s\n", corpus);
+		return 1;
+	}
+	
+	void *scanner = tree_sitter_roll20_script_external_scanner_create();
+	driver::Totals totals;
+	counting = true;
+	driver::scanCorpus(scanner, inputs, states, totals);
+	counting = false;
+	tree_sitter_roll20_script_external_scanner_destroy(scanner);
+	
+	printf("%zu inputs, %lu scans, %lu tokens: %lu allocations\n",
+		inputs.size(), totals.scans, totals.tokens, allocations.load());
+	if (allocations != 0) {
+		fprintf(stderr, "FAIL: the scanner allocated memory while scanning\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,256 @@
+#ifndef TREE_SITTER_ROLL20_SCRIPT_TEST_SCANNER_DRIVER_H_
+#define TREE_SITTER_ROLL20_SCRIPT_TEST_SCANNER_DRIVER_H_
+
+/*╔════════════════════════════════════════════════════════════
+  ║ Scanner driver
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Runs the external scanner over the inputs in the corpus the way a
+   │ parse would, without the tree-sitter runtime: a lexer over the decoded
+   │ input, and the parser's own external lex states (see
+   │ external_lex_states.c).
+   │
+   │ At each position, the scanner is restored to the current state and
+   │ tried with every external lex state. The longest token found is taken,
+   │ along with the state the scanner was in after it, and scanning resumes
+   │ at its end (or at the next character, if nothing was found). So nested
+   │ elements are entered and left as they would be in a parse.
+   └───────────────────────────────────────────────────────────*/
+
+#include <tree_sitter/parser.h>
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+extern "C" {
+
+void *tree_sitter_roll20_script_external_scanner_create(void);
+void tree_sitter_roll20_script_external_scanner_destroy(void *);
+bool tree_sitter_roll20_script_external_scanner_scan(void *, TSLexer *, const bool *);
+unsigned tree_sitter_roll20_script_external_scanner_serialize(void *, char *);
+void tree_sitter_roll20_script_external_scanner_deserialize(void *, const char *, unsigned);
+
+//see external_lex_states.c
+const bool *roll20_script_test_external_lex_states(unsigned *count, unsigned *width);
+
+}
+
+namespace driver {
+
+typedef std::vector<int32_t> Input;	//code points
+
+struct ExternalLexStates {
+	const bool *rows;
+	unsigned count;
+	unsigned width;
+	
+	ExternalLexStates() { rows = roll20_script_test_external_lex_states(&count, &width); }
+	const bool *operator[](unsigned i) const { return rows + i*width; }
+};
+
+
+/*┌──────────────────────────────
+  │ Corpus
+  └┬─────────────────────────────*/
+
+inline Input decodeUtf8(const std::string &text) {
+	Input input;
+	for (size_t i=0; i<text.size(); ) {
+		unsigned char c = text[i];
+		int length = c < 0x80 ? 1 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+		int32_t codePoint = length == 1 ? c : c & (0x7F >> length);
+		for (int j=1; j<length && i+j < text.size(); j++) codePoint = codePoint << 6 | (text[i+j] & 0x3F);
+		input.push_back(codePoint);
+		i += length;
+	}
+	return input;
+}
+
+inline bool isRule(const std::string &line, char c) {
+	return line.size() >= 3 && line.find_first_not_of(c) == std::string::npos;
+}
+
+//The input of each test in the corpus files (between its header and the "---" line).
+inline std::vector<Input> loadCorpus(const char *directory) {
+	std::vector<std::string> files;
+	if (DIR *dir = opendir(directory)) {
+		while (dirent *entry = readdir(dir)) {
+			std::string name = entry->d_name;
+			if (name.size() > 4 && name.compare(name.size() - 4, 4, ".txt") == 0) files.push_back(name);
+		}
+		closedir(dir);
+	}
+	std::sort(files.begin(), files.end());
+	
+	std::vector<Input> inputs;
+	for (const std::string &file : files) {
+		std::ifstream stream(std::string(directory) + "/" + file);
+		std::string line, text;
+		int rules = 0;		//header lines seen in the current test
+		bool inInput = false;
+		while (std::getline(stream, line)) {
+			if (!line.empty() && line.back() == '\r') line.pop_back();
+			if (isRule(line, '=')) {
+				rules = (rules + 1) % 2;
+				inInput = rules == 0;
+				text.clear();
+			}
+			else if (inInput && isRule(line, '-')) {
+				if (!text.empty()) text.pop_back();	//the line break before "---"
+				inputs.push_back(decodeUtf8(text));
+				inInput = false;
+			}
+			else if (inInput) {
+				text += line + "\n";
+			}
+		}
+	}
+	return inputs;
+}
+
+
+/*┌──────────────────────────────
+  │ Lexer
+  └┬─────────────────────────────*/
+
+struct Lexer {
+	TSLexer base;
+	const Input *input;
+	size_t position;
+	size_t markedEnd;
+	
+	Lexer(const Input &input, size_t position) : input(&input), position(position), markedEnd(position) {
+		base.advance = advance;
+		base.mark_end = markEnd;
+		base.get_column = getColumn;
+		base.is_at_included_range_start = isAtIncludedRangeStart;
+		base.eof = eof;
+		base.result_symbol = 0;
+		base.lookahead = at(position);
+	}
+	
+	int32_t at(size_t i) const { return i < input->size() ? (*input)[i] : 0; }
+	
+	static void advance(TSLexer *lexer, bool) {
+		Lexer *self = reinterpret_cast<Lexer *>(lexer);
+		if (self->position < self->input->size()) self->position++;
+		lexer->lookahead = self->at(self->position);
+	}
+	static void markEnd(TSLexer *lexer) {
+		Lexer *self = reinterpret_cast<Lexer *>(lexer);
+		self->markedEnd = self->position;
+	}
+	static uint32_t getColumn(TSLexer *) { return 0; }
+	static bool isAtIncludedRangeStart(const TSLexer *) { return false; }
+	static bool eof(const TSLexer *lexer) {
+		const Lexer *self = reinterpret_cast<const Lexer *>(lexer);
+		return self->position >= self->input->size();
+	}
+};
+
+
+/*┌──────────────────────────────
+  │ Scanning
+  └┬─────────────────────────────*/
+
+//The scanner's entry points: the external scanner's own, unless a benchmark passes others.
+struct ScannerFunctions {
+	bool (*scan)(void *, TSLexer *, const bool *);
+	unsigned (*serialize)(void *, char *);
+	void (*deserialize)(void *, const char *, unsigned);
+};
+
+const ScannerFunctions EXTERNAL_SCANNER = {
+	tree_sitter_roll20_script_external_scanner_scan,
+	tree_sitter_roll20_script_external_scanner_serialize,
+	tree_sitter_roll20_script_external_scanner_deserialize,
+};
+
+struct Totals {
+	unsigned long scans = 0;
+	unsigned long tokens = 0;	//tokens taken
+	unsigned long symbols = 0;	//sum of the symbols of the tokens taken, to compare runs
+};
+
+//A token that was taken, and the external lex state it was found with.
+struct Taken {
+	size_t position;
+	size_t end;
+	int symbol;
+	unsigned row;
+};
+
+//Scans one input with `scanner`, starting from the initial state. The tokens taken are added to
+// `taken`, if it's given.
+inline void scanInput(void *scanner, const Input &input, const ExternalLexStates &states, Totals &totals,
+	const ScannerFunctions &functions = EXTERNAL_SCANNER, std::vector<Taken> *taken = nullptr)
+{
+	char state[TREE_SITTER_SERIALIZATION_BUFFER_SIZE], next[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+	unsigned stateLength = 0, nextLength = 0;
+	functions.deserialize(scanner, nullptr, 0);
+	
+	for (size_t position = 0; position <= input.size(); ) {
+		size_t longest = position;
+		int symbol = -1;
+		unsigned longestRow = 0;
+		
+		//(row 0 is the state in which no external token is valid)
+		for (unsigned row=1; row<states.count; row++) {
+			functions.deserialize(scanner, state, stateLength);
+			Lexer lexer(input, position);
+			totals.scans++;
+			if (!functions.scan(scanner, &lexer.base, states[row])) continue;
+			if (lexer.markedEnd > longest) {
+				longest = lexer.markedEnd;
+				symbol = lexer.base.result_symbol;
+				longestRow = row;
+				nextLength = functions.serialize(scanner, next);
+			}
+		}
+		
+		if (symbol >= 0) {
+			totals.tokens++;
+			totals.symbols += unsigned(symbol);
+			if (taken) taken->push_back({position, longest, symbol, longestRow});
+			memcpy(state, next, nextLength);
+			stateLength = nextLength;
+			position = longest;
+		}
+		else {
+			position++;
+		}
+	}
+}
+
+inline void scanCorpus(void *scanner, const std::vector<Input> &inputs, const ExternalLexStates &states,
+	Totals &totals, const ScannerFunctions &functions = EXTERNAL_SCANNER)
+{
+	for (const Input &input : inputs) scanInput(scanner, input, states, totals, functions);
+}
+
+
+/*┌──────────────────────────────
+  │ Single tokens
+  └┬─────────────────────────────*/
+
+struct Token {
+	int symbol;		//-1 if nothing was found
+	size_t length;
+};
+
+//Scans one token at the start of `text` (UTF-8), with `scanner` in whatever state it's in.
+inline Token scanToken(void *scanner, const char *text, const bool *validSymbols) {
+	Input input = decodeUtf8(text);
+	Lexer lexer(input, 0);
+	if (!tree_sitter_roll20_script_external_scanner_scan(scanner, &lexer.base, validSymbols)) return {-1, 0};
+	return {int(lexer.base.result_symbol), lexer.markedEnd};
+}
+
+}	//namespace driver
+
+#endif  // TREE_SITTER_ROLL20_SCRIPT_TEST_SCANNER_DRIVER_H_
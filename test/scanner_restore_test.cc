@@ -0,0 +1,147 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Restore test
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ An incremental reparse doesn't rescan an input from its start: the
+   │ runtime restores the scanner from the state serialized after the last
+   │ external token it reuses. So restoring a serialized state has to give
+   │ the same scanner as having scanned up to it.
+   │
+   │ For each input in the corpus (see scanner_driver.h), the tokens the
+   │ driver takes are scanned again twice: continuously, by a scanner that
+   │ is never restored, and by a second scanner that is restored from the
+   │ first one's serialized state before each token. The second scanner is
+   │ used for every input, so it starts each one in some other state. Both
+   │ have to find the same tokens and serialize the same states, and
+   │ serializing a restored state has to give back the same bytes.
+   │
+   │ The driver always takes the longest token, so some tokens (e.g. a
+   │ roll template property's "{{", which a text run outlasts) are never
+   │ taken, and the states they leave are never restored. So from the
+   │ state before each taken token, every token that can be found at each
+   │ position up to the next one is also branched on: after it, a scanner
+   │ restored from the state it left has to find the same next token as
+   │ the scanner that found it, in every lex state.
+   │
+   │ Usage: scanner_restore_test [corpus directory]
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+
+//Scans each token that can be found at `position` from `state`, then the token after it in each lex state,
+// both with `branch` as it's left and with `restored` restored from the state it left. Returns false if they
+// differ.
+static bool checkBranches(void *branch, void *restored, const driver::Input &input, size_t position,
+	const char *state, unsigned length, const driver::ExternalLexStates &states)
+{
+	char after[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+	char next[TREE_SITTER_SERIALIZATION_BUFFER_SIZE], restoredNext[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+	
+	for (unsigned row=1; row<states.count; row++) {
+		for (unsigned nextRow=1; nextRow<states.count; nextRow++) {
+			tree_sitter_roll20_script_external_scanner_deserialize(branch, state, length);
+			driver::Lexer lexer(input, position);
+			if (!tree_sitter_roll20_script_external_scanner_scan(branch, &lexer.base, states[row])) break;
+			unsigned afterLength = tree_sitter_roll20_script_external_scanner_serialize(branch, after);
+			tree_sitter_roll20_script_external_scanner_deserialize(restored, after, afterLength);
+			
+			driver::Lexer nextLexer(input, lexer.markedEnd), restoredLexer(input, lexer.markedEnd);
+			bool found = tree_sitter_roll20_script_external_scanner_scan(branch, &nextLexer.base, states[nextRow]);
+			bool restoredFound = tree_sitter_roll20_script_external_scanner_scan(restored, &restoredLexer.base,
+				states[nextRow]);
+			if (restoredFound != found) return false;
+			if (!found) continue;
+			if (restoredLexer.base.result_symbol != nextLexer.base.result_symbol
+				|| restoredLexer.markedEnd != nextLexer.markedEnd) return false;
+			
+			unsigned nextLength = tree_sitter_roll20_script_external_scanner_serialize(branch, next);
+			unsigned restoredNextLength = tree_sitter_roll20_script_external_scanner_serialize(restored, restoredNext);
+			if (restoredNextLength != nextLength || memcmp(next, restoredNext, nextLength) != 0) return false;
+		}
+	}
+	return true;
+}
+
+int main(int argc, char **argv) {
+	const char *corpus = argc > 1 ? argv[1] : "../corpus";
+	
+	std::vector<driver::Input> inputs = driver::loadCorpus(corpus);
+	driver::ExternalLexStates states;
+	if (inputs.empty()) {
+		fprintf(stderr, "no tests found in %s\n", corpus);
+		return 1;
+	}
+	
+	void *scanner = tree_sitter_roll20_script_external_scanner_create();
+	void *continuous = tree_sitter_roll20_script_external_scanner_create();
+	void *restored = tree_sitter_roll20_script_external_scanner_create();
+	void *branch = tree_sitter_roll20_script_external_scanner_create();
+	char state[TREE_SITTER_SERIALIZATION_BUFFER_SIZE], again[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+	char after[TREE_SITTER_SERIALIZATION_BUFFER_SIZE], restoredAfter[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+	
+	int failures = 0;
+	unsigned long tokens = 0;
+	for (size_t i=0; i<inputs.size(); i++) {
+		const driver::Input &input = inputs[i];
+		driver::Totals totals;
+		std::vector<driver::Taken> taken;
+		driver::scanInput(scanner, input, states, totals, driver::EXTERNAL_SCANNER, &taken);
+		
+		tree_sitter_roll20_script_external_scanner_deserialize(continuous, nullptr, 0);
+		for (size_t t=0; t<taken.size(); t++) {
+			const driver::Taken &token = taken[t];
+			tokens++;
+			
+			unsigned length = tree_sitter_roll20_script_external_scanner_serialize(continuous, state);
+			tree_sitter_roll20_script_external_scanner_deserialize(restored, state, length);
+			unsigned lengthAgain = tree_sitter_roll20_script_external_scanner_serialize(restored, again);
+			if (lengthAgain != length || memcmp(state, again, length) != 0) {
+				fprintf(stderr, "FAIL: input %zu, token %zu: the restored state serializes differently\n", i, t);
+				failures++;
+				break;
+			}
+			bool branchesMatch = true;
+			size_t until = t+1 < taken.size() ? taken[t+1].position : input.size();
+			for (size_t position = t ? token.position : 0; branchesMatch && position <= until; position++)
+				branchesMatch = checkBranches(branch, restored, input, position, state, length, states);
+			if (!branchesMatch) {
+				fprintf(stderr, "FAIL: input %zu, token %zu: a restored scanner branches differently\n", i, t);
+				failures++;
+				break;
+			}
+			tree_sitter_roll20_script_external_scanner_deserialize(restored, state, length);
+			
+			driver::Lexer lexer(input, token.position), restoredLexer(input, token.position);
+			bool found = tree_sitter_roll20_script_external_scanner_scan(continuous, &lexer.base, states[token.row]);
+			bool restoredFound = tree_sitter_roll20_script_external_scanner_scan(restored, &restoredLexer.base,
+				states[token.row]);
+			if (!found || int(lexer.base.result_symbol) != token.symbol || lexer.markedEnd != token.end) {
+				fprintf(stderr, "FAIL: input %zu, token %zu: scanning continuously found a different token\n", i, t);
+				failures++;
+				break;
+			}
+			if (!restoredFound || restoredLexer.base.result_symbol != lexer.base.result_symbol
+				|| restoredLexer.markedEnd != lexer.markedEnd)
+			{
+				fprintf(stderr, "FAIL: input %zu, token %zu: the restored scanner found a different token\n", i, t);
+				failures++;
+				break;
+			}
+			
+			unsigned afterLength = tree_sitter_roll20_script_external_scanner_serialize(continuous, after);
+			unsigned restoredAfterLength = tree_sitter_roll20_script_external_scanner_serialize(restored, restoredAfter);
+			if (restoredAfterLength != afterLength || memcmp(after, restoredAfter, afterLength) != 0) {
+				fprintf(stderr, "FAIL: input %zu, token %zu: the restored scanner ended in a different state\n", i, t);
+				failures++;
+				break;
+			}
+		}
+	}
+	
+	tree_sitter_roll20_script_external_scanner_destroy(scanner);
+	tree_sitter_roll20_script_external_scanner_destroy(continuous);
+	tree_sitter_roll20_script_external_scanner_destroy(restored);
+	tree_sitter_roll20_script_external_scanner_destroy(branch);
+	
+	printf("%zu inputs, %lu tokens scanned continuously and restored, %d failures\n", inputs.size(), tokens, failures);
+	return failures ? 1 : 0;
+}
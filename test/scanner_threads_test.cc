@@ -0,0 +1,79 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Thread test
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Scans the corpus (see scanner_driver.h) on several threads at once, one
+   │ scanner per thread, while another thread keeps changing the scanner
+   │ limits. `make check` builds it with ThreadSanitizer, which reports any
+   │ data race between the scanners. Every thread also has to find exactly
+   │ the tokens a single scanner finds on its own.
+   │
+   │ Usage: scanner_threads_test [threads] [passes] [corpus directory]
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+#include "scanner_limits.h"
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+int main(int argc, char **argv) {
+	unsigned threadCount = argc > 1 ? atoi(argv[1]) : 8;
+	int passes = argc > 2 ? atoi(argv[2]) : 4;
+	const char *corpus = argc > 3 ? argv[3] : "../corpus";
+	
+	std::vector<driver::Input> inputs = driver::loadCorpus(corpus);
+	driver::ExternalLexStates states;
+	if (inputs.empty()) {
+		fprintf(stderr, "no tests found in %s\n", corpus);
+		return 1;
+	}
+	
+	//what one scanner finds on its own
+	driver::Totals expected;
+	void *scanner = tree_sitter_roll20_script_external_scanner_create();
+	driver::scanCorpus(scanner, inputs, states, expected);
+	tree_sitter_roll20_script_external_scanner_destroy(scanner);
+	
+	std::vector<driver::Totals> totals(threadCount);
+	std::vector<std::thread> threads;
+	for (unsigned t=0; t<threadCount; t++) {
+		threads.emplace_back([&, t]() {
+			for (int pass=0; pass<passes; pass++) {
+				//a new scanner each pass, so that creating one races with the settings too
+				void *scanner = tree_sitter_roll20_script_external_scanner_create();
+				driver::Totals passTotals;
+				driver::scanCorpus(scanner, inputs, states, passTotals);
+				tree_sitter_roll20_script_external_scanner_destroy(scanner);
+				
+				if (pass == 0) totals[t] = passTotals;
+				else if (passTotals.tokens != totals[t].tokens || passTotals.symbols != totals[t].symbols) {
+					totals[t].tokens = 0;
+				}
+			}
+		});
+	}
+	
+	//the settings are shared; setting them to what they already are doesn't change any results
+	std::atomic<bool> done{false};
+	std::thread settings([&]() {
+		Roll20ScriptScannerLimits limits;
+		tree_sitter_roll20_script_get_scanner_limits(&limits);
+		while (!done) tree_sitter_roll20_script_set_scanner_limits(&limits);
+	});
+	
+	for (std::thread &thread : threads) thread.join();
+	done = true;
+	settings.join();
+	
+	int failures = 0;
+	for (unsigned t=0; t<threadCount; t++) {
+		if (totals[t].tokens != expected.tokens || totals[t].symbols != expected.symbols) {
+			fprintf(stderr, "FAIL: thread %u found %lu tokens (symbol sum %lu) instead of %lu (%lu)\n",
+				t, totals[t].tokens, totals[t].symbols, expected.tokens, expected.symbols);
+			failures++;
+		}
+	}
+	printf("%u threads, %d passes each over %zu inputs: %lu tokens per pass, %d failures\n",
+		threadCount, passes, inputs.size(), expected.tokens, failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,258 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Token test
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Scans short inputs one token at a time and checks which token the
+   │ scanner returns for each, and how long it is. Each case starts with a
+   │ new scanner, and its steps are scanned in order, so the first steps can
+   │ enter the elements that the last one is scanned in.
+   │
+   │ A case can set the scanner's limits (see scanner_limits.h), and checks
+   │ which limits were reached by the time its last step is scanned.
+   │
+   │ The sets of valid symbols are rows of a table of this test's own, one
+   │ entry per symbol, the same as the parser's, so the test doesn't depend
+   │ on src/parser.c: the scanner gets the width of the rows from the
+   │ language defined here.
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+#include "scanner_limits.h"
+#include <stdlib.h>
+#include <deque>
+#include <initializer_list>
+
+//the same order as the externals in grammar.js
+enum TokenType {
+	ROLLQUERY_START, ROLLQUERY_END,
+	INLINEROLL_START, INLINEROLL_END,
+	LABEL_START, LABEL_END,
+	BUTTON_START, BUTTON_END,
+	GROUPROLL_START, GROUPROLL_END,
+	TABLEROLL_START, TABLEROLL_END,
+	PIPE, COMMA, LEFT_BRACE, RIGHT_BRACE, LEFT_PAREN, RIGHT_PAREN, COLON,
+	FLAG_START, FLAG_END, ROLLTEMPLATE_PROPERTY_START, ROLLTEMPLATE_PROPERTY_END,
+	HTML_ENTITY,
+	AMPERSAND,
+	TEXT,
+	DEFAULT_PIPE,
+	SYMBOL_COUNT
+};
+
+const int NONE = -1;
+
+//Like the parser's table, the rows are contiguous, since the scanner caches them by row number.
+const unsigned MAX_ROWS = 64;
+bool rows[MAX_ROWS][SYMBOL_COUNT];
+unsigned rowCount = 1;	//(row 0 is the state in which no external token is valid)
+
+extern "C" const TSLanguage *tree_sitter_roll20_script(void) {
+	static TSLanguage language = [] {
+		TSLanguage language = {};
+		language.external_token_count = SYMBOL_COUNT;
+		language.external_scanner.states = &rows[0][0];
+		return language;
+	}();
+	return &language;
+}
+
+typedef const bool *ValidSymbols;
+
+//Each set gets a row of its own.
+ValidSymbols valid(std::initializer_list<int> symbols) {
+	if (rowCount == MAX_ROWS) {
+		fprintf(stderr, "the test has more sets of valid symbols than rows\n");
+		exit(1);
+	}
+	bool *row = rows[rowCount++];
+	for (int symbol : symbols) row[symbol] = true;
+	return row;
+}
+
+struct Step {
+	const char *text;
+	ValidSymbols validSymbols;
+	int symbol;
+	size_t length;
+	int stateLength = -1;	//how many bytes the scanner's state serializes to afterward, if it's checked
+};
+
+//the steps of `parts`, one after another
+std::vector<Step> steps(std::initializer_list<std::vector<Step>> parts) {
+	std::vector<Step> all;
+	for (const std::vector<Step> &part : parts) all.insert(all.end(), part.begin(), part.end());
+	return all;
+}
+
+std::vector<Step> times(unsigned count, const Step &step) {
+	return std::vector<Step>(count, step);
+}
+
+const Roll20ScriptScannerLimits DEFAULT_LIMITS = {
+	ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN
+};
+
+struct Case {
+	const char *name;
+	std::vector<Step> steps;
+	unsigned limitsReached = 0;		//ROLL20_SCRIPT_LIMIT_* flags
+	Roll20ScriptScannerLimits limits = DEFAULT_LIMITS;
+};
+
+
+/*┌──────────────────────────────
+  │ Cases
+  └┬─────────────────────────────*/
+
+//after a roll query's prompt
+const ValidSymbols QUERY = valid({TEXT, PIPE, DEFAULT_PIPE, ROLLQUERY_END, HTML_ENTITY, AMPERSAND});
+//after the first option
+const ValidSymbols OPTIONS = valid({TEXT, PIPE, ROLLQUERY_END, HTML_ENTITY, AMPERSAND, COMMA});
+const ValidSymbols QUERY_START = valid({TEXT, ROLLQUERY_START, HTML_ENTITY, AMPERSAND});
+
+const Step ENTER_QUERY = {"?{", QUERY_START, ROLLQUERY_START, 2};
+const Step ENTER_NESTED_QUERY = {"?&#123;", QUERY_START, ROLLQUERY_START, 7};
+const ValidSymbols TEXT_ONLY = valid({TEXT});
+//every symbol is valid while the parser is recovering from an error
+const ValidSymbols ALL = valid({
+	ROLLQUERY_START, ROLLQUERY_END, INLINEROLL_START, INLINEROLL_END, LABEL_START, LABEL_END,
+	BUTTON_START, BUTTON_END, GROUPROLL_START, GROUPROLL_END, TABLEROLL_START, TABLEROLL_END,
+	PIPE, COMMA, LEFT_BRACE, RIGHT_BRACE, LEFT_PAREN, RIGHT_PAREN, COLON,
+	FLAG_START, FLAG_END, ROLLTEMPLATE_PROPERTY_START, ROLLTEMPLATE_PROPERTY_END,
+	HTML_ENTITY, AMPERSAND, TEXT, DEFAULT_PIPE
+});
+
+const Step RECOVERING = {"abc", ALL, TEXT, 3};
+const Step RECOVERED = {"abc", TEXT_ONLY, TEXT, 3};
+
+//enters `depth` roll queries, each nested in the one before it
+std::vector<Step> enterQueries(unsigned depth) {
+	static std::deque<std::string> texts;
+	std::vector<Step> steps;
+	for (unsigned i=1; i<=depth; i++) {
+		std::string amps;
+		for (unsigned j=2; j<i; j++) amps += "amp;";
+		texts.push_back(i == 1 ? "?{" : "?&" + amps + "#123;");
+		steps.push_back({texts.back().c_str(), QUERY_START, ROLLQUERY_START, texts.back().size()});
+	}
+	return steps;
+}
+
+const Step ENTER_PROPERTY = {"{{", valid({TEXT, ROLLTEMPLATE_PROPERTY_START}), ROLLTEMPLATE_PROPERTY_START, 2};
+
+std::vector<Case> cases() {
+	return {
+		//roll query separators
+		{"a separator followed by another is a pipe", {ENTER_QUERY, {"|a|b}", QUERY, PIPE, 1}}},
+		{"an empty option is still an option", {ENTER_QUERY, {"||}", QUERY, PIPE, 1}}},
+		{"a separator followed by the end of the query is a default pipe", {ENTER_QUERY, {"|a,A}", QUERY, DEFAULT_PIPE, 1}}},
+		{"an empty default value", {ENTER_QUERY, {"|}", QUERY, DEFAULT_PIPE, 1}}},
+		{"the end of the input ends the lookahead", {ENTER_QUERY, {"|abc", QUERY, DEFAULT_PIPE, 1}}},
+		{"a pipe within an attribute doesn't count", {ENTER_QUERY, {"|a@{c|d}}", QUERY, DEFAULT_PIPE, 1}}},
+		{"a pipe after an ability does", {ENTER_QUERY, {"|a%{x|y}b|c}", QUERY, PIPE, 1}}},
+		{"an encoded pipe belongs to a nested element", {ENTER_QUERY, {"|b&#124;c}", QUERY, DEFAULT_PIPE, 1}}},
+		{"only a pipe is valid after an option", {ENTER_QUERY, {"|a}", OPTIONS, PIPE, 1}}},
+		{"a nested query's separators are encoded as many times as its delimiters",
+			{ENTER_QUERY, ENTER_NESTED_QUERY, {"&vert;e&comma;f&vert;g&rcub;", QUERY, PIPE, 6}}},
+		{"a nested query ends at its encoded brace",
+			{ENTER_QUERY, ENTER_NESTED_QUERY, {"&#124;b&#125;c}", QUERY, DEFAULT_PIPE, 6}}},
+		{"a raw pipe belongs to the enclosing query",
+			{ENTER_QUERY, ENTER_NESTED_QUERY, {"&vert;a|b&rcub;", QUERY, DEFAULT_PIPE, 6}}},
+		{"within a roll template property, a separator can be encoded once",
+			{ENTER_PROPERTY, ENTER_QUERY, {"|a&vert;b}", QUERY, PIPE, 1}}},
+		{"within a roll template property, the property's end isn't a separator",
+			{ENTER_PROPERTY, ENTER_QUERY, {"|a}}", QUERY, DEFAULT_PIPE, 1}}},
+		
+		//text runs (where an element can't end yet, its closer still isn't text)
+		{"a flag's value stops at the flag's end", {{"&{", valid({FLAG_START}), FLAG_START, 2},
+			{"atkdmg}", TEXT_ONLY, TEXT, 6}}},
+		{"a prompt stops at the query's end", {ENTER_QUERY, {"p}", TEXT_ONLY, TEXT, 1}}},
+		{"a table's name stops at the table's end", {{"t[", valid({TABLEROLL_START}), TABLEROLL_START, 2},
+			{"name]", TEXT_ONLY, TEXT, 4}}},
+		{"a flag's value can contain a colon", {{"&{", valid({FLAG_START}), FLAG_START, 2},
+			{"a:b}", TEXT_ONLY, TEXT, 3}}},
+		
+		//recovery budget
+		{"recovering scans text runs as usual", steps({
+			times(ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET - 1, RECOVERING), {{"abc [[1", ALL, TEXT, 4}}})},
+		{"once the budget is spent, the rest of the input is text", steps({
+			times(ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, RECOVERING), {{"abc [[1", ALL, TEXT, 7}}}),
+			ROLL20_SCRIPT_LIMIT_RECOVERY_BUDGET},
+		{"each error has a budget of its own", steps({
+			times(ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET - 1, RECOVERING), {RECOVERED},
+			times(ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET - 1, RECOVERING), {{"abc [[1", ALL, TEXT, 4}}})},
+		{"past the error, the state is the same as if there had been none", steps({
+			times(3, RECOVERING), {{"abc", TEXT_ONLY, TEXT, 3, 0}}})},
+		{"a smaller budget", steps({times(2, RECOVERING), {{"[[1", ALL, TEXT, 3}}}),
+			ROLL20_SCRIPT_LIMIT_RECOVERY_BUDGET, {2, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN}},
+		
+		//nesting depth (the innermost of the default depth's queries need a longer entity chain than the default)
+		{"below the maximum depth, a delimiter starts another element", {ENTER_QUERY, {"?{x}", QUERY_START, ROLLQUERY_START, 2}},
+			0, {ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, 2, ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN}},
+		{"at the maximum depth, it's text", {ENTER_QUERY, {"?{x", QUERY_START, TEXT, 3}},
+			ROLL20_SCRIPT_LIMIT_DEPTH, {ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, 1, ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN}},
+		{"the default maximum depth can be reached",
+			enterQueries(ROLL20_SCRIPT_DEFAULT_MAX_DEPTH),
+			0, {ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH}},
+		{"but not passed",
+			steps({enterQueries(ROLL20_SCRIPT_DEFAULT_MAX_DEPTH), {{"?{x", QUERY_START, TEXT, 3}}}),
+			ROLL20_SCRIPT_LIMIT_DEPTH,
+			{ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH}},
+		
+		//entity chains
+		{"an entity is decoded as many times as its depth calls for",
+			steps({enterQueries(3), {{"&amp;amp;vert;x", QUERY, HTML_ENTITY, 14}}})},
+		{"past the chain limit, the rest of the chain is text",
+			steps({enterQueries(3), {{"&amp;amp;vert;x", QUERY, HTML_ENTITY, 9}}}),
+			ROLL20_SCRIPT_LIMIT_ENTITY_CHAIN, {ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, 2}},
+		{"a chain that ends at the limit doesn't reach it",
+			steps({enterQueries(3), {{"&amp;amp;x", QUERY, HTML_ENTITY, 9}}}),
+			0, {ROLL20_SCRIPT_DEFAULT_RECOVERY_BUDGET, ROLL20_SCRIPT_DEFAULT_MAX_DEPTH, 2}},
+		{"the default chain limit is below the default depth limit",
+			steps({enterQueries(ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN + 1), {{
+				"&amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;amp;vert;", QUERY, HTML_ENTITY,
+				1 + 4*ROLL20_SCRIPT_DEFAULT_MAX_ENTITY_CHAIN}}}),
+			ROLL20_SCRIPT_LIMIT_ENTITY_CHAIN},
+	};
+}
+
+
+int main() {
+	int failures = 0, passed = 0;
+	for (const Case &test : cases()) {
+		tree_sitter_roll20_script_set_scanner_limits(&test.limits);
+		tree_sitter_roll20_script_take_limits_reached();
+		void *scanner = tree_sitter_roll20_script_external_scanner_create();
+		bool ok = true;
+		for (size_t i=0; i<test.steps.size(); i++) {
+			const Step &step = test.steps[i];
+			driver::Token token = driver::scanToken(scanner, step.text, step.validSymbols);
+			if (token.symbol != step.symbol || (step.symbol != NONE && token.length != step.length)) {
+				fprintf(stderr, "FAIL: %s: step %zu (\"%s\") scanned symbol %d, length %zu; expected symbol %d, length %zu\n",
+					test.name, i+1, step.text, token.symbol, token.length, step.symbol, step.length);
+				ok = false;
+				break;
+			}
+			char state[TREE_SITTER_SERIALIZATION_BUFFER_SIZE];
+			if (step.stateLength >= 0) {
+				unsigned stateLength = tree_sitter_roll20_script_external_scanner_serialize(scanner, state);
+				if (int(stateLength) != step.stateLength) {
+					fprintf(stderr, "FAIL: %s: step %zu (\"%s\") left a state of %u bytes; expected %d\n",
+						test.name, i+1, step.text, stateLength, step.stateLength);
+					ok = false;
+					break;
+				}
+			}
+		}
+		unsigned limitsReached = tree_sitter_roll20_script_take_limits_reached();
+		if (ok && limitsReached != test.limitsReached) {
+			fprintf(stderr, "FAIL: %s: reached limits 0x%x; expected 0x%x\n", test.name, limitsReached, test.limitsReached);
+			ok = false;
+		}
+		tree_sitter_roll20_script_external_scanner_destroy(scanner);
+		if (ok) passed++;
+		else failures++;
+	}
+	
+	printf("%d cases passed, %d failures\n", passed, failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,57 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Trace test
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Scans the corpus (see scanner_driver.h) with tracing compiled in, then
+   │ destroys the scanner on another thread before copying out the events
+   │ on this one. `make check` builds it with AddressSanitizer, which reports
+   │ it if the events refer to the destroyed scanner.
+   │
+   │ Usage: scanner_trace_test [corpus directory]
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+#include "scanner_trace.h"
+#include <thread>
+
+int main(int argc, char **argv) {
+	const char *corpus = argc > 1 ? argv[1] : "../corpus";
+	
+	std::vector<driver::Input> inputs = driver::loadCorpus(corpus);
+	driver::ExternalLexStates states;
+	
+	void *scanner = tree_sitter_roll20_script_external_scanner_create();
+	driver::Totals totals;
+	driver::scanCorpus(scanner, inputs, states, totals);
+	std::thread([scanner]() { tree_sitter_roll20_script_external_scanner_destroy(scanner); }).join();
+	
+	Roll20ScriptTraceEvent events[ROLL20_SCRIPT_TRACE_CAPACITY];
+	size_t count = tree_sitter_roll20_script_scanner_trace(events, ROLL20_SCRIPT_TRACE_CAPACITY);
+	
+	int failures = 0;
+	if (count != ROLL20_SCRIPT_TRACE_CAPACITY) {
+		fprintf(stderr, "FAIL: copied %zu events instead of %d\n", count, ROLL20_SCRIPT_TRACE_CAPACITY);
+		failures++;
+	}
+	for (size_t i=1; i<count; i++) {
+		if (events[i].scan != events[i-1].scan + 1) {
+			fprintf(stderr, "FAIL: event %zu is scan %u, after scan %u\n", i, events[i].scan, events[i-1].scan);
+			failures++;
+			break;
+		}
+	}
+	
+	//another thread has its own events
+	size_t otherCount = 1;
+	std::thread([&otherCount]() {
+		Roll20ScriptTraceEvent event;
+		otherCount = tree_sitter_roll20_script_scanner_trace(&event, 1);
+	}).join();
+	if (otherCount != 0) {
+		fprintf(stderr, "FAIL: a thread that didn't scan has %zu events\n", otherCount);
+		failures++;
+	}
+	
+	printf("%lu scans, %zu events copied after the scanner was destroyed, %d failures\n",
+		totals.scans, count, failures);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+//Tests stopping parses on the thread pool (parseAsync and cancelParse in src/binding.cc, and scheduler.js):
+// cancelling them, through cancelParse() or an AbortSignal, and letting them run out of time.
+//
+//Usage: node test/scheduler_test.js (once the addon is built, e.g., by npm install)
+
+const assert = require("assert");
+
+const Roll20Script = require("../index");
+const { Scheduler } = require("../scheduler");
+const { test } = require("./driver");
+
+//A macro long enough that parsing it takes far longer than cancelling it does (deeply nested queries, as
+// in bench/scheduler.js).
+function longMacro(n = 20000) {
+  let macro = "&{template:default} ";
+  for (let i = 0; i < n; i++) macro += `{{q${i}=?{Choice|a,?{Inner&#124;x&#125;|b,?{Inner&#124;x&#44;1&#124;y&#44;2&#125;|c}}} `;
+  return macro;
+}
+const LONG_MACRO = longMacro();
+const SHORT_MACRO = "[[1d20+@{selected|str_mod}]] ?{Bonus|0}";
+
+//Starts a parse, and returns its id and a promise of its result.
+function parseAsync(source, options) {
+  let id = -1;
+  const result = new Promise((resolve, reject) => {
+    id = Roll20Script.parseAsync(source, options, (error, tree) => error ? reject(error) : resolve(tree));
+  });
+  return { id, result };
+}
+
+//whether a parse that reuses a pooled parser still gives the right tree
+async function checkShortParses() {
+  const expected = Roll20Script.parseBatch([SHORT_MACRO]).nodeCounts[0];
+  const trees = await Promise.all([...Array(8)].map(() => parseAsync(SHORT_MACRO, { slice: 1000 }).result));
+  for (const tree of trees) {
+    assert.strictEqual(tree.hasError, false);
+    assert.strictEqual(tree.nodeCount, expected);
+  }
+}
+
+test("cancelParse only takes a number", () => {
+  for (const id of [undefined, null, "0", {}, [0]]) {
+    assert.throws(() => Roll20Script.cancelParse(id), TypeError, String(id));
+  }
+  assert.throws(() => Roll20Script.cancelParse(), TypeError);
+  //(an id that isn't a parse's is fine)
+  Roll20Script.cancelParse(0xFFFFFFFF);
+});
+
+test("cancelling a parse between slices", async () => {
+  const { id, result } = parseAsync(LONG_MACRO, { slice: 100 });
+  Roll20Script.cancelParse(id);
+  await assert.rejects(result, { code: "ABORT_ERR" });
+  await checkShortParses();
+});
+
+test("cancelling a parse in the middle of its only slice", async () => {
+  const { id, result } = parseAsync(LONG_MACRO, { slice: 0 });
+  setTimeout(() => Roll20Script.cancelParse(id), 5);
+  await assert.rejects(result, { code: "ABORT_ERR" });
+  await checkShortParses();
+});
+
+test("cancelling one parse doesn't cancel another", async () => {
+  const cancelled = parseAsync(LONG_MACRO, { slice: 100 });
+  const other = parseAsync(SHORT_MACRO, { slice: 100 });
+  Roll20Script.cancelParse(cancelled.id);
+  await assert.rejects(cancelled.result, { code: "ABORT_ERR" });
+  assert.strictEqual((await other.result).hasError, false);
+});
+
+test("a deadline that has already passed", async () => {
+  await assert.rejects(parseAsync(SHORT_MACRO, { timeout: 0 }).result, { code: "ETIMEDOUT" });
+  await assert.rejects(parseAsync(SHORT_MACRO, { timeout: -1 }).result, { code: "ETIMEDOUT" });
+});
+
+test("a deadline that passes during the parse", async () => {
+  await assert.rejects(parseAsync(LONG_MACRO, { slice: 100, timeout: 1 }).result, { code: "ETIMEDOUT" });
+  //(with no slices, the deadline is the only timeout)
+  await assert.rejects(parseAsync(LONG_MACRO, { slice: 0, timeout: 1 }).result, { code: "ETIMEDOUT" });
+  await checkShortParses();
+});
+
+test("a deadline that's met", async () => {
+  const tree = await parseAsync(SHORT_MACRO, { slice: 100, timeout: 60000 }).result;
+  assert.strictEqual(tree.hasError, false);
+  assert.strictEqual(tree.nodeCount, Roll20Script.parseBatch([SHORT_MACRO]).nodeCounts[0]);
+});
+
+test("Scheduler: an aborted signal", async () => {
+  const scheduler = new Scheduler({ slice: 100 });
+  const controller = new AbortController();
+  const parse = scheduler.parse(LONG_MACRO, { signal: controller.signal });
+  controller.abort();
+  await assert.rejects(parse, { code: "ABORT_ERR" });
+
+  //a signal that's aborted already stops the parse before it starts
+  await assert.rejects(scheduler.parse(SHORT_MACRO, { signal: controller.signal }), { code: "ABORT_ERR" });
+});
+
+test("Scheduler: a timeout", async () => {
+  const scheduler = new Scheduler({ slice: 100 });
+  await assert.rejects(scheduler.parse(LONG_MACRO, { timeout: 1 }), { code: "ETIMEDOUT" });
+  const tree = await scheduler.parse(SHORT_MACRO, { timeout: 60000 });
+  assert.strictEqual(tree.hasError, false);
+  assert.ok(tree.types.includes("script"));
+});
+
+test("Scheduler: aborting after the parse is done", async () => {
+  const scheduler = new Scheduler({ slice: 100 });
+  const controller = new AbortController();
+  const tree = await scheduler.parse(SHORT_MACRO, { signal: controller.signal });
+  controller.abort();
+  assert.strictEqual(tree.hasError, false);
+});
@@ -0,0 +1,153 @@
+//Tests parsing UTF-8 bytes where they are (parseBytes in src/binding.cc, and stream.js): characters of each
+// length, the non-ASCII characters that are whitespace, invalid sequences, and messages and characters
+// that are split between chunks.
+//
+//Usage: node test/stream_test.js (once the addon is built, e.g., by npm install)
+
+const assert = require("assert");
+const fs = require("fs");
+const os = require("os");
+const path = require("path");
+
+const Roll20Script = require("../index");
+const { parseChunks, parseFile } = require("../stream");
+const { test } = require("./driver");
+
+//a flattened tree's nodes as [type name, startIndex, endIndex, parent, ...]
+function named(nodes, types = Roll20Script.types) {
+  const result = [];
+  for (let i = 0; i < nodes.length; i += 4) result.push(types[nodes[i]], nodes[i+1], nodes[i+2], nodes[i+3]);
+  return result;
+}
+
+//The nodes of `source` parsed as a string, with their indices converted to byte offsets.
+function stringNodes(source) {
+  const batch = Roll20Script.parseBatch([source], { trees: true });
+  assert.strictEqual(batch.hasError[0], 0, source);
+  const nodes = named(batch.trees[0], batch.types);
+  for (let i = 0; i < nodes.length; i += 4) {
+    nodes[i+1] = Buffer.byteLength(source.slice(0, nodes[i+1]));
+    nodes[i+2] = Buffer.byteLength(source.slice(0, nodes[i+2]));
+  }
+  return nodes;
+}
+
+//Checks that each node is within the bytes, and within its parent.
+function checkNesting(nodes, length) {
+  for (let i = 0; i < nodes.length; i += 4) {
+    assert.ok(nodes[i+1] >= 0 && nodes[i+1] <= nodes[i+2] && nodes[i+2] <= length, `node ${i/4}`);
+    const parent = nodes[i+3];
+    if (parent < 0) continue;
+    assert.ok(nodes[4*parent+1] <= nodes[i+1] && nodes[i+2] <= nodes[4*parent+2], `node ${i/4}`);
+  }
+}
+
+const SOURCES = [
+  "é [[1d6]] é",                            //2 bytes
+  "€ ?{Bonus €|0} €",                      //3 bytes
+  "😀 @{selected|hp} 😀",                   //4 bytes
+  "&{template:t} {{😀=[[1d20]]}} {{é=€}}",
+  "a b [[1]] \u0085 c",          //no-break space and next line, which are whitespace
+  " ?{a\u0085|b c,1}",
+];
+
+test("parseBytes: UTF-8 characters", () => {
+  for (const source of SOURCES) {
+    const bytes = Buffer.from(source);
+    const tree = Roll20Script.parseBytes(bytes, 0, bytes.length, { trees: true });
+    assert.strictEqual(tree.hasError, false, source);
+    assert.deepStrictEqual([tree.startIndex, tree.endIndex], [0, bytes.length], source);
+    assert.deepStrictEqual(named(tree.nodes), stringNodes(source), source);
+  }
+});
+
+test("parseBytes: invalid sequences", () => {
+  const invalid = [
+    [0x80],              //a continuation byte on its own
+    [0xFF],              //not a byte of any character
+    [0xC0, 0xAF],        //an overlong encoding of "/"
+    [0xED, 0xA0, 0x80],  //a surrogate
+    [0xF0, 0x9F, 0x98],  //a character that ends early
+  ];
+  const roll = Buffer.from("[[1d6]]");
+  for (const sequence of invalid) {
+    const bytes = Buffer.concat([Buffer.from("a "), Buffer.from(sequence), Buffer.from(" "), roll]);
+    const where = Buffer.from(sequence).toString("hex");
+    const tree = Roll20Script.parseBytes(bytes, 0, bytes.length, { trees: true });
+    assert.deepStrictEqual([tree.startIndex, tree.endIndex], [0, bytes.length], where);
+    checkNesting(tree.nodes, bytes.length);
+
+    //the bytes after them are still parsed
+    const nodes = named(tree.nodes);
+    const start = bytes.length - roll.length;
+    assert.ok(nodes.some((type, i) => i % 4 === 0 && type === "inlineRoll" && nodes[i+1] === start
+      && nodes[i+2] === bytes.length), where);
+  }
+
+  //a message that ends in the middle of a character (the parser mustn't read past its end)
+  const bytes = Buffer.from("[[1]] é [[2]]");
+  const tree = Roll20Script.parseBytes(bytes, 0, 7, { trees: true });
+  assert.deepStrictEqual([tree.startIndex, tree.endIndex], [0, 7]);
+  checkNesting(tree.nodes, 7);
+});
+
+test("parseBytes: bounds", () => {
+  const bytes = Buffer.from("[[1]] é");
+  assert.strictEqual(Roll20Script.parseBytes(bytes, 5, 2).endIndex, 0);
+  assert.strictEqual(Roll20Script.parseBytes(bytes, -1, 1e12).endIndex, bytes.length);
+  assert.strictEqual(Roll20Script.parseBytes(bytes).endIndex, bytes.length);
+});
+
+//the messages of `source`, parsed one at a time as strings, with byte offsets
+function expectedMessages(source) {
+  const boundaries = Roll20Script.splitMessages(source);
+  const messages = [];
+  for (let i = 0; i < boundaries.length; i += 2) {
+    messages.push({
+      startIndex: Buffer.byteLength(source.slice(0, boundaries[i])),
+      endIndex: Buffer.byteLength(source.slice(0, boundaries[i+1])),
+      nodes: stringNodes(source.slice(boundaries[i], boundaries[i+1])),
+    });
+  }
+  return messages;
+}
+
+function actualMessages(messages) {
+  return messages.map(({ startIndex, endIndex, tree }) => ({ startIndex, endIndex, nodes: named(tree.nodes, tree.types) }));
+}
+
+async function collect(messages) {
+  const result = [];
+  for await (const message of messages) result.push(message);
+  return result;
+}
+
+const MACRO = SOURCES.join("\n") + "\n\n&{template:t} {{a=1\n}} {{€=😀}}\n" + SOURCES.join("\n");
+
+test("parseChunks: messages and characters split between chunks", async () => {
+  const bytes = Buffer.from(MACRO);
+  const expected = expectedMessages(MACRO);
+  for (const size of [1, 2, 3, 7, 64, bytes.length]) {
+    const chunks = [];
+    for (let i = 0; i < bytes.length; i += size) chunks.push(bytes.subarray(i, i + size));
+    assert.deepStrictEqual(actualMessages(await collect(parseChunks(chunks))), expected, `chunks of ${size}`);
+  }
+
+  const counted = await collect(parseChunks([bytes], { trees: false }));
+  assert.deepStrictEqual(counted.map(message => message.tree.nodeCount), expected.map(message => message.nodes.length / 4));
+});
+
+test("parseFile: windows smaller than the file and than a message", async () => {
+  const directory = fs.mkdtempSync(path.join(os.tmpdir(), "roll20-script-"));
+  const file = path.join(directory, "macros.txt");
+  try {
+    fs.writeFileSync(file, MACRO);
+    const expected = expectedMessages(MACRO);
+    for (const window of [16, 100, 1 << 20]) {
+      assert.deepStrictEqual(actualMessages(await collect(parseFile(file, { window }))), expected, `window of ${window}`);
+    }
+  }
+  finally {
+    fs.rmSync(directory, { recursive: true });
+  }
+});
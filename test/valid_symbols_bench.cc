@@ -0,0 +1,70 @@
+/*╔════════════════════════════════════════════════════════════
+  ║ Valid-symbol benchmark
+  ╚╤═══════════════════════════════════════════════════════════*/
+ /*│ Times the scanner over the corpus (see scanner_driver.h) twice: as it
+   │ is, with the cache of valid-symbol bitmasks, and with RowValidSymbols,
+   │ which reads the parser's row directly for each symbol it tests, the way
+   │ the scanner did before the rows were cached. Both have to find the same
+   │ tokens.
+   │
+   │ The scanner is included rather than linked, since RowValidSymbols is
+   │ internal to it.
+   │
+   │ Usage: valid_symbols_bench [passes] [corpus directory]
+   └───────────────────────────────────────────────────────────*/
+
+#include "scanner_driver.h"
+#include "../src/scanner.cc"
+#include <chrono>
+#include <cstdlib>
+
+namespace {
+
+typedef BasicScanner<RowValidSymbols> RowScanner;
+
+const driver::ScannerFunctions ROW_SCANNER = {
+	[](void *scanner, TSLexer *lexer, const bool *validSymbols) {
+		return static_cast<RowScanner *>(scanner)->scan(lexer, validSymbols);
+	},
+	[](void *scanner, char *buffer) { return static_cast<RowScanner *>(scanner)->serialize(buffer); },
+	[](void *scanner, const char *buffer, unsigned length) {
+		static_cast<RowScanner *>(scanner)->deserialize(buffer, length);
+	},
+};
+
+driver::Totals run(const char *name, void *scanner, const driver::ScannerFunctions &functions, int passes,
+	const std::vector<driver::Input> &inputs, const driver::ExternalLexStates &states)
+{
+	driver::Totals totals;
+	auto start = std::chrono::steady_clock::now();
+	for (int i=0; i<passes; i++) driver::scanCorpus(scanner, inputs, states, totals, functions);
+	double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	
+	printf("%s: %lu tokens (symbol sum %lu), %.1f ns/scan\n",
+		name, totals.tokens / passes, totals.symbols / passes, elapsed / totals.scans);
+	return totals;
+}
+
+}	//namespace
+
+int main(int argc, char **argv) {
+	int passes = argc > 1 ? atoi(argv[1]) : 20;
+	const char *corpus = argc > 2 ? argv[2] : "../corpus";
+	
+	std::vector<driver::Input> inputs = driver::loadCorpus(corpus);
+	driver::ExternalLexStates states;
+	printf("%zu inputs, %u external lex states\n", inputs.size(), states.count);
+	
+	Scanner *cached = new Scanner();
+	RowScanner *row = new RowScanner();
+	driver::Totals cachedTotals = run("cached bitmasks", cached, driver::EXTERNAL_SCANNER, passes, inputs, states);
+	driver::Totals rowTotals = run("rows read directly", row, ROW_SCANNER, passes, inputs, states);
+	delete cached;
+	delete row;
+	
+	if (cachedTotals.tokens != rowTotals.tokens || cachedTotals.symbols != rowTotals.symbols) {
+		fprintf(stderr, "FAIL: the two found different tokens\n");
+		return 1;
+	}
+	return 0;
+}